@@ -0,0 +1,534 @@
+#include <chrono>
+#include <functional>
+#include <sstream>
+
+#include "Bounds.hpp"
+#include "Convergence.hpp"
+#include "Enclosing.hpp"
+#include "Endgame.hpp"
+#include "Heatmap.hpp"
+#include "PerfCounters.hpp"
+#include "Simulator.hpp"
+#include "Trajectory.hpp"
+
+using namespace std;
+
+struct Kernel
+{
+    string name_;
+    function<void()> run_;
+};
+
+struct Measurement
+{
+    long iterations_;
+    double ns_;
+    PerfCounters::Sample counters_;
+};
+
+struct Result
+{
+    string kernel_;
+    int zombies_;
+    double ns_;
+    double calibrationNs_;
+};
+
+class NullBuffer: public streambuf
+{
+protected:
+    int overflow(int c)
+    {
+        return c;
+    }
+};
+
+volatile long sink;
+
+// Fixed work that no change to the bot touches: square roots, integer
+// mixing and scattered loads over a table larger than L1. It is timed next
+// to every kernel, so its ratio to the baseline tells how fast the machine
+// ran at that moment compared with the one that wrote the baseline.
+void calibrationWork()
+{
+    static vector<unsigned> table(1 << 16, 1);
+    unsigned index = 12345;
+    double total = 0;
+    for (int i = 0; i < 4096; i++)
+    {
+        index = index*1103515245u + 12345u;
+        unsigned value = table[index >> 16];
+        table[index >> 16] = value + 1;
+        total += sqrt(double(value + i));
+    }
+    sink = total;
+}
+
+Measurement measure(Kernel const &kernel, PerfCounters &perf,
+    double minSeconds)
+{
+    Measurement result;
+    kernel.run_();
+    long iterations = 1;
+    while (true)
+    {
+        auto start = chrono::steady_clock::now();
+        perf.start();
+        for (long i = 0; i < iterations; i++)
+        {
+            kernel.run_();
+        }
+        result.counters_ = perf.stop();
+        double seconds = chrono::duration<double>(
+            chrono::steady_clock::now() - start).count();
+        if (seconds >= minSeconds || iterations >= (1L << 30))
+        {
+            result.iterations_ = iterations;
+            result.ns_ = seconds*1e9;
+            return result;
+        }
+        iterations *= 2;
+    }
+}
+
+string turnInput(GameData const &data)
+{
+    ostringstream out;
+    out << data.ashPos_.x_ << " " << data.ashPos_.y_ << endl
+        << data.humans_.size() << endl;
+    for (auto human: data.humans_)
+    {
+        out << human.id_ << " " << human.pos_.x_ << " "
+            << human.pos_.y_ << endl;
+    }
+    out << data.zombies_.size() << endl;
+    for (auto zombie: data.zombies_)
+    {
+        out << zombie.id_ << " " << zombie.pos_.x_ << " " << zombie.pos_.y_
+            << " " << zombie.nextPos_.x_ << " " << zombie.nextPos_.y_ << endl;
+    }
+    return out.str();
+}
+
+const int queueTurns = 20;
+
+struct Fixture
+{
+    Fixture(int zombies, int humans):
+        data_(Simulator::randomScenario(
+            humans > 0 ? humans : max(1, zombies/4), zombies, zombies)),
+        endgameData_(Simulator::randomScenario(3,
+            min(zombies, EndgameSolver::maxZombies), zombies)),
+        input_(turnInput(data_)),
+        initial_(data_),
+        center_(Rules::mapWidth/2, Rules::mapHeight/2),
+        queueTurn_(0)
+    {
+        game_.setVerbose(false);
+        turnGame_.setVerbose(false);
+        game_.loadGameData(data_);
+        game_.doTheTriage();
+        game_.rateZombies();
+        trajectories_.update(data_);
+        heatmap_.build(data_, trajectories_);
+        for (auto zombie: data_.zombies_)
+        {
+            zombiePositions_.push_back(zombie.nextPos_);
+            if (group_.size() < 8)
+                group_.push_back(zombie.id_);
+        }
+        for (auto human: data_.humans_)
+        {
+            if (rescueTargets_.size() == RescueScheduler::exactLimit)
+                break;
+            RescueTarget target = {human.id_, human.pos_, 5 + human.id_ % 20,
+                {RescueTarget::noIntercept, human.pos_}};
+            rescueTargets_.push_back(target);
+        }
+        Simulator sim(data_);
+        for (int turn = 0; turn < queueTurns && !sim.isOver(); turn++)
+        {
+            turns_.push_back(sim.getData());
+            sim.step(data_.ashPos_);
+        }
+        vec_ = VectorOpers::resize(
+            VectorOpers::subtract(center_, data_.ashPos_),
+            Helpers::ashStepSize);
+        preferred_ = game_.calcDestination(data_.ashPos_, vec_);
+    }
+    GameData data_;
+    GameData endgameData_;
+    vector<GameData> turns_;
+    istringstream input_;
+    Simulator initial_;
+    Simulator sim_;
+    GameController game_;
+    GameController turnGame_;
+    TrajectoryCache trajectories_;
+    HumanQueue queue_;
+    vector<Interception> interceptions_;
+    vector<RescueTarget> rescueTargets_;
+    RescueScheduler rescue_;
+    ZombieClusters clusters_;
+    EnclosingCircle enclosing_;
+    ConvergenceForecaster forecaster_;
+    KillHeatmap heatmap_;
+    DestinationSearch destinations_;
+    CleanupTour cleanup_;
+    EndgameSolver endgame_;
+    vector<Position> zombiePositions_;
+    vector<int> group_;
+    Position center_;
+    Position vec_;
+    Position preferred_;
+    int queueTurn_;
+};
+
+vector<Kernel> makeKernels(Fixture &f)
+{
+    vector<Kernel> kernels;
+    kernels.push_back(Kernel{"distance", [&f]()
+    {
+        double total = 0;
+        for (auto zombie: f.data_.zombies_)
+        {
+            total += Helpers::distance(f.data_.ashPos_, zombie);
+        }
+        sink = total;
+    }});
+    kernels.push_back(Kernel{"steps", [&f]()
+    {
+        Human human = *f.data_.humans_.begin();
+        long total = 0;
+        for (auto zombie: f.data_.zombies_)
+        {
+            total += Helpers::steps(human, zombie);
+        }
+        sink = total;
+    }});
+    kernels.push_back(Kernel{"interceptAll", [&f]()
+    {
+        Intercept::solveAll(f.data_.ashPos_, f.data_.zombies_,
+            f.interceptions_);
+        sink = f.interceptions_.back().turns_;
+    }});
+    kernels.push_back(Kernel{"doTheTriage", [&f]()
+    {
+        f.game_.doTheTriage();
+    }});
+    kernels.push_back(Kernel{"triageFullScan", [&f]()
+    {
+        f.game_.doTheTriage(f.data_.humans_);
+    }});
+    kernels.push_back(Kernel{"humanQueueStep", [&f]()
+    {
+        f.queue_.update(f.turns_[f.queueTurn_++ % f.turns_.size()]);
+    }});
+    kernels.push_back(Kernel{"rescueSchedule", [&f]()
+    {
+        sink = f.rescue_.schedule(f.data_.ashPos_, f.rescueTargets_).saved_;
+    }});
+    kernels.push_back(Kernel{"clusterZombies", [&f]()
+    {
+        f.clusters_.build(f.data_.zombies_,
+            f.game_.getParams().neighbourhoodRadius_);
+        sink = f.clusters_.getCount();
+    }});
+    kernels.push_back(Kernel{"enclosingCircle", [&f]()
+    {
+        sink = f.enclosing_.solve(f.zombiePositions_).radius_;
+    }});
+    kernels.push_back(Kernel{"singleShotSearch", [&f]()
+    {
+        sink = f.enclosing_.firstSingleShot(f.trajectories_, f.group_,
+            f.trajectories_.getHorizon());
+    }});
+    kernels.push_back(Kernel{"comboForecast", [&f]()
+    {
+        f.forecaster_.update(f.data_, f.trajectories_);
+        sink = f.forecaster_.getTargetCount();
+    }});
+    kernels.push_back(Kernel{"heatmapBuild", [&f]()
+    {
+        f.heatmap_.build(f.data_, f.trajectories_);
+    }});
+    kernels.push_back(Kernel{"heatmapBestCell", [&f]()
+    {
+        int count = 0;
+        f.heatmap_.bestReachableCell(f.heatmap_.getTurns(), f.data_.ashPos_,
+            count);
+        sink = count;
+    }});
+    kernels.push_back(Kernel{"rateZombies", [&f]()
+    {
+        f.game_.rateZombies();
+    }});
+    kernels.push_back(Kernel{"destinationSearch", [&f]()
+    {
+        f.destinations_.search(f.data_.ashPos_, f.preferred_,
+            f.data_.zombies_, GameController::destinationEvaluations);
+        sink = f.destinations_.getBestKills();
+    }});
+    kernels.push_back(Kernel{"cleanupTour", [&f]()
+    {
+        sink = f.cleanup_.plan(f.data_, GameController::cleanupEvaluations);
+    }});
+    kernels.push_back(Kernel{"countZombiesInRange", [&f]()
+    {
+        sink = f.game_.countZombiesInRange(f.center_, f.data_.zombies_);
+    }});
+    kernels.push_back(Kernel{"findNearestZombie", [&f]()
+    {
+        sink = f.game_.findNearestZombie(f.center_, f.data_.zombies_).id_;
+    }});
+    kernels.push_back(Kernel{"parseInput", [&f]()
+    {
+        f.input_.clear();
+        f.input_.seekg(0);
+        f.turnGame_.loadGameData(f.input_);
+    }});
+    kernels.push_back(Kernel{"fullTurn", [&f]()
+    {
+        f.turnGame_.loadGameData(f.data_);
+        Position solution = f.turnGame_.playTurn();
+        f.turnGame_.writeSolution(solution);
+    }});
+    kernels.push_back(Kernel{"trajectoryUpdate", [&f]()
+    {
+        f.trajectories_.clear();
+        f.trajectories_.update(f.data_);
+    }});
+    kernels.push_back(Kernel{"trajectoryQuery", [&f]()
+    {
+        long total = 0;
+        for (auto zombie: f.data_.zombies_)
+        {
+            total += f.trajectories_.positionAt(zombie.id_, 10).x_;
+        }
+        sink = total;
+    }});
+    kernels.push_back(Kernel{"tightBound", [&f]()
+    {
+        sink = Bounds::tight(f.data_, 0);
+    }});
+    kernels.push_back(Kernel{"endgameSolve", [&f]()
+    {
+        sink = f.endgame_.solve(f.endgameData_);
+    }});
+    kernels.push_back(Kernel{"simulatorStep", [&f]()
+    {
+        f.sim_ = f.initial_;
+        f.sim_.step(f.center_);
+        sink = f.sim_.getScore();
+    }});
+    return kernels;
+}
+
+void writeJson(ostream &out, vector<Result> const &results)
+{
+    out << "{\"results\":[" << endl;
+    for (unsigned i = 0; i < results.size(); i++)
+    {
+        out << "{\"kernel\":\"" << results[i].kernel_
+            << "\",\"zombies\":" << results[i].zombies_
+            << ",\"ns\":" << results[i].ns_
+            << ",\"calibrationNs\":" << results[i].calibrationNs_ << "}"
+            << (i + 1 < results.size() ? "," : "") << endl;
+    }
+    out << "]}" << endl;
+}
+
+bool readJson(string const &path, vector<Result> &results)
+{
+    ifstream ifs(path.c_str(), std::ifstream::in);
+    if (!ifs)
+        return false;
+    string line;
+    while (getline(ifs, line))
+    {
+        size_t kernel = line.find("\"kernel\":\"");
+        size_t zombies = line.find("\"zombies\":");
+        size_t ns = line.find("\"ns\":");
+        if (kernel == string::npos || zombies == string::npos
+            || ns == string::npos)
+            continue;
+        kernel += 10;
+        Result result;
+        result.kernel_ = line.substr(kernel, line.find('"', kernel) - kernel);
+        result.zombies_ = atoi(line.c_str() + zombies + 10);
+        result.ns_ = atof(line.c_str() + ns + 5);
+        size_t calibrationNs = line.find("\"calibrationNs\":");
+        result.calibrationNs_ = calibrationNs == string::npos ? 0
+            : atof(line.c_str() + calibrationNs + 16);
+        results.push_back(result);
+    }
+    return true;
+}
+
+// Each ratio is divided by the ratio of the calibration times measured
+// next to the kernel, so a slower or busier machine does not read as a
+// regression of every kernel. Baselines without them compare raw times.
+// Every ratio is printed; the ones over the threshold are marked.
+int compare(vector<Result> const &results, vector<Result> const &baseline,
+    double threshold)
+{
+    int regressions = 0;
+    for (auto result: results)
+    {
+        for (auto base: baseline)
+        {
+            if (base.kernel_ != result.kernel_
+                || base.zombies_ != result.zombies_)
+                continue;
+            double ratio = result.ns_/base.ns_;
+            if (result.calibrationNs_ > 0 && base.calibrationNs_ > 0)
+                ratio /= result.calibrationNs_/base.calibrationNs_;
+            bool regressed = ratio > 1.0 + threshold;
+            if (regressed)
+                regressions++;
+            cout << (regressed ? "REGRESSION " : "") << result.kernel_ << " "
+                << result.zombies_ << ": " << result.ns_ << " ns vs "
+                << base.ns_ << " ns baseline (x" << ratio << ")" << endl;
+        }
+    }
+    cout << regressions << " regressions over the "
+        << threshold*100 << "% threshold" << endl;
+    return regressions;
+}
+
+void printUsage()
+{
+    cerr << "usage: bench [--perf] [-t seconds] [-r repetitions]"
+        << " [--json out.json] [--baseline baseline.json]"
+        << " [--threshold fraction] [--strict] [-H humans] [zombieCount...]"
+        << endl;
+}
+
+int main(int argc, char** argv)
+{
+    bool perfMode = false;
+    double minSeconds = 0.02;
+    int repetitions = 3;
+    int humans = 0;
+    double threshold = 0.25;
+    bool strict = false;
+    string jsonPath;
+    string baselinePath;
+    vector<int> sizes;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--perf")
+            perfMode = true;
+        else if (arg == "-t" && hasValue)
+            minSeconds = atof(argv[++i]);
+        else if (arg == "-r" && hasValue)
+            repetitions = max(1, atoi(argv[++i]));
+        else if (arg == "-H" && hasValue)
+            humans = atoi(argv[++i]);
+        else if (arg == "--json" && hasValue)
+            jsonPath = argv[++i];
+        else if (arg == "--baseline" && hasValue)
+            baselinePath = argv[++i];
+        else if (arg == "--threshold" && hasValue)
+            threshold = atof(argv[++i]);
+        else if (arg == "--strict")
+            strict = true;
+        else if (isdigit(arg[0]))
+            sizes.push_back(atoi(arg.c_str()));
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+    if (sizes.empty())
+    {
+        sizes = {1, 10, 25, 50, 75, 99, 500, 2000};
+    }
+
+    PerfCounters perf;
+    if (perfMode && !perf.anyAvailable())
+    {
+        cerr << "perf_event_open: no hardware counters available"
+            << " (check /proc/sys/kernel/perf_event_paranoid)" << endl;
+    }
+    cout << "kernel zombies ns/op calibration-ns";
+    if (perfMode)
+    {
+        for (int e = 0; e < PerfCounters::eventCount; e++)
+        {
+            cout << " " << PerfCounters::eventName(PerfCounters::Event(e))
+                << "/op";
+        }
+        cout << " IPC";
+    }
+    cout << endl;
+
+    NullBuffer nullBuffer;
+    streambuf* coutBuf = cout.rdbuf();
+    vector<Result> results;
+    Kernel calibration = {"calibration", calibrationWork};
+    for (auto zombies: sizes)
+    {
+        Fixture fixture(zombies, humans);
+        for (auto kernel: makeKernels(fixture))
+        {
+            Measurement best;
+            double calibrationNs = 0;
+            for (int r = 0; r < repetitions; r++)
+            {
+                Measurement c = measure(calibration, perf, minSeconds);
+                if (r == 0 || c.ns_/c.iterations_ < calibrationNs)
+                    calibrationNs = c.ns_/c.iterations_;
+                cout.rdbuf(&nullBuffer);
+                Measurement m = measure(kernel, perf, minSeconds);
+                cout.rdbuf(coutBuf);
+                if (r == 0 || m.ns_/m.iterations_ < best.ns_/best.iterations_)
+                    best = m;
+            }
+            Result result = {kernel.name_, zombies, best.ns_/best.iterations_,
+                calibrationNs};
+            results.push_back(result);
+            cout << kernel.name_ << " " << zombies << " " << result.ns_
+                << " " << calibrationNs;
+            if (perfMode)
+            {
+                for (int e = 0; e < PerfCounters::eventCount; e++)
+                {
+                    if (perf.isAvailable(PerfCounters::Event(e)))
+                        cout << " " << double(best.counters_.values_[e])
+                            /best.iterations_;
+                    else
+                        cout << " n/a";
+                }
+                uint64_t cycles = best.counters_.values_[PerfCounters::cycles];
+                if (cycles != 0)
+                    cout << " " << double(best.counters_.values_[
+                        PerfCounters::instructions])/cycles;
+                else
+                    cout << " n/a";
+            }
+            cout << endl;
+        }
+    }
+
+    if (!jsonPath.empty())
+    {
+        ofstream ofs(jsonPath.c_str(), std::ofstream::out);
+        writeJson(ofs, results);
+    }
+    if (!baselinePath.empty())
+    {
+        vector<Result> baseline;
+        if (!readJson(baselinePath, baseline))
+        {
+            cerr << "cannot read " << baselinePath << endl;
+            return 1;
+        }
+        int regressions = compare(results, baseline, threshold);
+        return strict && regressions > 0 ? 2 : 0;
+    }
+    return 0;
+}
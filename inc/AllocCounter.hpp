@@ -0,0 +1,16 @@
+#ifndef ALLOCCOUNTER_HPP
+#define ALLOCCOUNTER_HPP
+
+#include <cstdint>
+
+// Counts every heap allocation of the process. Linking the AllocCounter
+// library replaces the global operator new and delete, binaries that do not
+// link it keep the standard ones.
+namespace AllocCounter
+{
+uint64_t allocations();
+uint64_t bytes();
+void reset();
+}
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Bump-pointer arena for turn-scoped scratch data. Memory is released only
+// by reset(), which rewinds to the first block and keeps every block for
+// the next turn, so a warmed-up arena does not touch the heap. Copies start
+// empty: scratch memory is never shared between owners.
+class Arena
+{
+public:
+    Arena(size_t blockSize = 1 << 16):
+        blockSize_(blockSize), block_(0), offset_(0), used_(0)
+    {}
+    Arena(Arena const &other):
+        blockSize_(other.blockSize_), block_(0), offset_(0), used_(0)
+    {}
+    Arena &operator=(Arena const &)
+    {
+        reset();
+        return *this;
+    }
+    ~Arena()
+    {
+        for (auto &block: blocks_)
+        {
+            delete[] block.data_;
+        }
+    }
+    void* allocate(size_t bytes, size_t align)
+    {
+        while (block_ < blocks_.size())
+        {
+            size_t start = (offset_ + align - 1) & ~(align - 1);
+            if (start + bytes <= blocks_[block_].size_)
+            {
+                offset_ = start + bytes;
+                used_ += bytes;
+                return blocks_[block_].data_ + start;
+            }
+            block_++;
+            offset_ = 0;
+        }
+        Block block;
+        block.size_ = bytes + align > blockSize_ ? bytes + align : blockSize_;
+        block.data_ = new char[block.size_];
+        blocks_.push_back(block);
+        return allocate(bytes, align);
+    }
+    void reset()
+    {
+        block_ = 0;
+        offset_ = 0;
+        used_ = 0;
+    }
+    size_t getUsed()
+    {
+        return used_;
+    }
+    size_t getCapacity()
+    {
+        size_t capacity = 0;
+        for (auto &block: blocks_)
+        {
+            capacity += block.size_;
+        }
+        return capacity;
+    }
+private:
+    struct Block
+    {
+        char* data_;
+        size_t size_;
+    };
+    std::vector<Block> blocks_;
+    size_t blockSize_;
+    size_t block_;
+    size_t offset_;
+    size_t used_;
+};
+
+template <typename T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    ArenaAllocator(Arena* arena): arena_(arena)
+    {}
+    template <typename U>
+    ArenaAllocator(ArenaAllocator<U> const &other): arena_(other.getArena())
+    {}
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t)
+    {}
+    Arena* getArena() const
+    {
+        return arena_;
+    }
+    template <typename U>
+    bool operator==(ArenaAllocator<U> const &other) const
+    {
+        return arena_ == other.getArena();
+    }
+    template <typename U>
+    bool operator!=(ArenaAllocator<U> const &other) const
+    {
+        return arena_ != other.getArena();
+    }
+private:
+    Arena* arena_;
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ArenaAllocator<T> >;
+
+// Empties a scratch vector and drops its storage, which the last reset()
+// of its arena may already have handed out again; owners call it on every
+// scratch member right after resetting their arena.
+template <typename T>
+void renew(ScratchVector<T> &vector)
+{
+    ScratchVector<T>(vector.get_allocator()).swap(vector);
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef BOUNDS_HPP
+#define BOUNDS_HPP
+
+#include "Simulator.hpp"
+
+// Upper bounds on the final score reachable from a state, for pruning
+// searches and for measuring how far a played game is from the best
+// possible one. Both bounds assume every remaining zombie dies in one
+// shot, which maximises the combo sum. loose() keeps all current humans
+// alive. tight() first finds humans that are certainly eaten: a zombie
+// heads for them, stays closer to them than to Ash and to every other
+// human all the way, and Ash (closing in at most 1400 units a turn)
+// cannot reach it in time. The shot cannot come before the earliest turn
+// Ash can reach any zombie, so humans certainly eaten before then do not
+// count, and if every human is certainly eaten the game ends at zero.
+namespace Bounds
+{
+int comboValue(int humansAlive, int kills);
+int loose(int score, int humansAlive, int zombiesAlive);
+int loose(Simulator &sim);
+int tight(GameData const &data, int score);
+int tight(Simulator &sim);
+int earliestKill(Position ash, Position zombie);
+int certainDeath(GameData const &data, Human const &human);
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef CLEANUP_HPP
+#define CLEANUP_HPP
+
+#include <vector>
+
+#include "GameData.hpp"
+#include "Intercept.hpp"
+
+// Shortest tour that puts every zombie in shooting range, for the phase
+// where no human is at risk and only game length is left to win. Zombies
+// are moving targets that walk straight to their nearest human, or to
+// where Ash starts, and wait there; a stop is the interception of one
+// zombie from where Ash finished the previous stop,
+// and it also kills every other zombie in range of Ash at that turn. The
+// tour is built nearest interception first and then improved by segment
+// reversals and single-stop relocations while the evaluation budget
+// lasts. Tours are ranked by their last kill, then by the sum of kill
+// turns, so relocations that only bring kills forward still count; a
+// candidate is dropped as soon as it runs past the best last kill.
+class CleanupTour
+{
+public:
+    CleanupTour();
+    int plan(GameData const &data, int maxEvaluations);
+    Position getFirstMove();
+    int getTurns();
+    int getEvaluations();
+private:
+    static const int unbounded = 1 << 29;
+    struct Cost
+    {
+        int turns_;
+        int killTurns_;
+        bool operator<(Cost const &rhs) const;
+    };
+    Cost evaluate(std::vector<int> const &order, Position &firstMove,
+        int maxTurns);
+    void nearestFirst();
+    void improve(int maxEvaluations);
+    bool tryCandidate();
+    Position zombieAt(int index, int turn);
+    int stopTurns(Position ash, int index, int turn, Position &stop);
+    int coverAt(Position ash, int turn);
+    std::vector<Zombie> zombies_;
+    std::vector<Position> targets_;
+    std::vector<int> arrivals_;
+    std::vector<char> killed_;
+    std::vector<int> order_;
+    std::vector<int> candidate_;
+    Position ash_;
+    Position firstMove_;
+    Cost cost_;
+    int evaluations_;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef CLUSTERS_HPP
+#define CLUSTERS_HPP
+
+#include <vector>
+
+#include "Arena.hpp"
+#include "GameData.hpp"
+
+// Groups zombies whose next positions are closer than a radius, taking the
+// transitive closure (union-find over the radius graph). Zombies are
+// bucketed in a grid with cells a little smaller than radius/sqrt(2), so
+// zombies sharing a cell are always linked and two cells only need their
+// pairs checked until the first link joins them. Cluster ids are dense and
+// numbered in zombie id order; sizes and coordinate sums are kept per
+// cluster, so every cluster query is O(1) after build(). The same grid
+// answers the one-hop neighbourhood the strategies aim at by looking at
+// the cells within reach instead of every zombie, 25 cells at the default
+// radius, both as a centroid and as the zombie ids. The per-turn
+// membership lives in an arena that build() resets, so a warmed-up
+// instance does not allocate; copies start empty, like the arena.
+class ZombieClusters
+{
+public:
+    ZombieClusters();
+    ZombieClusters(ZombieClusters const &);
+    ZombieClusters &operator=(ZombieClusters const &);
+    void build(FlatSet<Zombie> const &zombies, double radius);
+    void clear();
+    int clusterOf(int zombieId);
+    int getCount();
+    int size(int cluster);
+    Position centroid(int cluster);
+    int largest();
+    Position neighbourhoodCentroid(Position center);
+    void neighbourhood(Position center, std::vector<int> &zombieIds);
+private:
+    void collectNeighbours(Position center);
+    void linkCells(int a, int b, bool cellsLinked);
+    int cellOf(Position pos);
+    int find(int index);
+    void unite(int a, int b);
+    double radius_;
+    double cellSize_;
+    int reach_;
+    int columns_;
+    int rows_;
+    Arena arena_;
+    ScratchVector<Position> points_;
+    ScratchVector<int> ids_;
+    ScratchVector<int> neighbours_;
+    ScratchVector<int> cells_;
+    ScratchVector<int> cellStart_;
+    ScratchVector<int> cellItems_;
+    ScratchVector<int> parent_;
+    ScratchVector<int> clusterByIndex_;
+    ScratchVector<int> clusterById_;
+    ScratchVector<int> sizes_;
+    ScratchVector<long long> sumX_;
+    ScratchVector<long long> sumY_;
+};
+
+#endif
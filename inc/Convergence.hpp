@@ -0,0 +1,64 @@
+#ifndef CONVERGENCE_HPP
+#define CONVERGENCE_HPP
+
+#include <vector>
+
+#include "GameData.hpp"
+#include "Trajectory.hpp"
+
+struct ComboStep
+{
+    int kills_;
+    int turn_;
+};
+
+struct ConvergenceTarget
+{
+    int targetId_;
+    Position pos_;
+    int deadline_;
+    int ashTurns_;
+    int first_;
+    int steps_;
+};
+
+// Combo forecast for every target zombies are converging on. Pursuers of
+// one target walk straight at it, so a pursuer starting r away is at most
+// 2000 from the target from turn ceil((r - 2000)/400) on: a disk centred
+// on the target holds the k nearest pursuers from the k-th of those turns.
+// Each target gets that ladder of (kills, turn) steps, one per distinct
+// turn, cut at its deadline: the turn the first pursuer reaches a human
+// (Ash is never eaten, so the ladder for Ash is not cut). Turns count like
+// TrajectoryCache::positionAt, targets come from the cache and Ash is
+// assumed to stand still. update() is O(Z log Z) and uses no simulation;
+// it ignores the referee's flooring, which may leave a pursuer up to about
+// two units a turn off the straight-line schedule.
+//
+// Nothing in the bot or the planners reads it yet. Sending Ash to the
+// human with the biggest combo he can reach in time lost score, so the
+// ladders are left for a planner to use as cheap combo-timing estimates.
+class ConvergenceForecaster
+{
+public:
+    static const int noDeadline = 1 << 29;
+
+    void update(GameData const &data, TrajectoryCache &trajectories);
+    int getTargetCount();
+    ConvergenceTarget const &getTarget(int index);
+    ComboStep const &getStep(int index, int step);
+    int findTarget(int targetId);
+    int bestKills(int index, int byTurn);
+private:
+    struct Pursuer
+    {
+        int targetId_;
+        double dist_;
+        Position target_;
+        bool operator<(Pursuer const &rhs) const;
+    };
+    std::vector<Pursuer> pursuers_;
+    std::vector<ConvergenceTarget> targets_;
+    std::vector<ComboStep> steps_;
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef DEBUGLOG_HPP
+#define DEBUGLOG_HPP
+
+#include "GameController.hpp"
+
+// Streams GameController::debugPrint dumps (AshPos, HumanCount, humans,
+// ZombieCount, zombies) back into GameData, one turn at a time. Unrelated
+// lines are skipped, a dump interrupted by a misplaced dump line is dropped.
+class DebugLogParser
+{
+public:
+    DebugLogParser(std::istream &input);
+    bool next(GameData &data);
+    long getLineCount();
+    long getSkippedLines();
+    long getDroppedTurns();
+    static bool isNewGame(GameData const &prev, GameData const &curr);
+private:
+    enum Expect
+    {
+        ashPos,
+        humanCount,
+        human,
+        zombieCount,
+        zombie
+    };
+    bool parseLine(GameData &data);
+    void restart();
+    std::istream &input_;
+    std::string line_;
+    Expect expect_;
+    int remaining_;
+    long lineCount_;
+    long skippedLines_;
+    long droppedTurns_;
+};
+
+#endif
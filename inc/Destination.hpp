@@ -0,0 +1,63 @@
+#ifndef DESTINATION_HPP
+#define DESTINATION_HPP
+
+#include <vector>
+
+#include "Arena.hpp"
+#include "GameData.hpp"
+#include "Heatmap.hpp"
+#include "Profiler.hpp"
+
+// Anytime search for the Ash destination that puts the most zombies in
+// shooting range after the move. Destinations are points within one Ash
+// step, so Ash lands exactly on them. A coarse lattice covering the step
+// disk is scored first, nearest to the preferred destination first, then
+// the best few candidates are refined on a lattice of half the spacing
+// around each, down to single units. Kill counts are flat over most of the
+// disk, so equal counts are ranked by how deep zombies just out of range
+// sit in a band around it, which steers the refinement towards the next
+// kill; remaining ties go to the point closest to the preferred
+// destination. Given a kill heatmap, coarse points predicted more than
+// heatmapSlack kills below the best coarse cell are skipped, leaving their
+// evaluations to the refinement. The search stops when it runs out of
+// range-count evaluations, so a small budget still returns the best coarse
+// point seen and a large one ends at integer resolution. Candidates live in
+// an arena reset by every search; copies start empty.
+class DestinationSearch
+{
+public:
+    static const int coarseStep = 250;
+    static const int frontierSize = 4;
+    static const int nearMissBand = 2*coarseStep;
+    static const int heatmapSlack = 2;
+
+    DestinationSearch();
+    DestinationSearch(DestinationSearch const &);
+    DestinationSearch &operator=(DestinationSearch const &);
+    Position search(Position ash, Position preferred,
+        FlatSet<Zombie> const &zombies, int maxEvaluations,
+        KillHeatmap* heatmap = 0);
+    int getBestKills();
+    int getEvaluations();
+private:
+    struct Candidate
+    {
+        Position pos_;
+        int kills_;
+        double pressure_;
+        double offset_;
+        bool operator<(Candidate const &rhs) const;
+    };
+    bool evaluate(Position pos);
+    bool seen(Position pos);
+    Arena arena_;
+    ScratchVector<Position> zombies_;
+    ScratchVector<Position> lattice_;
+    ScratchVector<Candidate> candidates_;
+    ScratchVector<Candidate> frontier_;
+    Position preferred_;
+    int evaluations_;
+    int budget_;
+};
+
+#endif
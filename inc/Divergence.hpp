@@ -0,0 +1,60 @@
+#ifndef DIVERGENCE_HPP
+#define DIVERGENCE_HPP
+
+#include <ostream>
+
+#include "Simulator.hpp"
+
+// Checks the Simulator against the referee during a live game: after every
+// turn it predicts the next input from the current state and the chosen
+// move, and compares the prediction with what actually arrives. Each
+// divergent turn is logged with its counts and first offending entity.
+// The monitor runs every live turn, so it steps a member Simulator into a
+// reused prediction buffer and formats text only for a logged divergence.
+class DivergenceMonitor: public TurnListener
+{
+public:
+    DivergenceMonitor(std::ostream* log = 0);
+    void onTurn(GameData const &data, Position solution);
+    void predict(GameData const &data, Position solution);
+    bool check(GameData const &actual);
+    GameData const &getPrediction();
+    void report(std::ostream &out);
+
+    int getCheckedTurns();
+    int getDivergentTurns();
+    int getAshMismatches();
+    int getZombieMismatches();
+    int getKillMismatches();
+    int getHumanMismatches();
+private:
+    struct Mismatch
+    {
+        const char* entity_;
+        int id_;
+        const char* what_;
+        bool positions_;
+        Position predicted_;
+        Position actual_;
+    };
+
+    void mismatch(int &counter, const char* entity, int id, const char* what);
+    void mismatch(int &counter, const char* entity, int id, const char* what,
+        Position predicted, Position actual);
+    void mismatch(int &counter, Mismatch const &entry);
+    std::ostream* log_;
+    bool hasPrediction_;
+    Simulator sim_;
+    GameData predicted_;
+    int turn_;
+    int checkedTurns_;
+    int divergentTurns_;
+    int ashMismatches_;
+    int zombieMismatches_;
+    int killMismatches_;
+    int humanMismatches_;
+    int turnMismatches_;
+    Mismatch firstMismatch_;
+};
+
+#endif
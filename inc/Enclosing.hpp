@@ -0,0 +1,50 @@
+#ifndef ENCLOSING_HPP
+#define ENCLOSING_HPP
+
+#include <random>
+#include <vector>
+
+#include "GameData.hpp"
+#include "Trajectory.hpp"
+
+struct Circle
+{
+    double x_;
+    double y_;
+    double radius_;
+};
+
+// Minimum enclosing circle of a group of zombies (Welzl's algorithm in its
+// iterative move-to-front form, on a seeded shuffle, expected O(n)). After
+// the outer loop has seen i points the circle encloses exactly those, so
+// its radius only grows; fits() stops as soon as it passes the limit and
+// leaves that partial circle, a lower bound on the true radius, in
+// getCircle().
+//
+// firstSingleShot() looks for the earliest turn at which the predicted
+// positions of a group fit inside the shooting range around one point.
+// No zombie moves more than a step a turn, so the radius shrinks by at
+// most a step a turn and a group that is far from fitting skips the turns
+// it cannot possibly fit in. The range is reduced by one unit so Ash can
+// stand on the rounded centre.
+class EnclosingCircle
+{
+public:
+    EnclosingCircle(unsigned seed = 1);
+    Circle const &solve(std::vector<Position> const &points);
+    bool fits(std::vector<Position> const &points, double limit);
+    int firstSingleShot(TrajectoryCache &cache,
+        std::vector<int> const &zombieIds, int maxTurn);
+    Circle const &getCircle();
+    Position shotPoint();
+private:
+    bool enclose(double limit);
+    static bool contains(Circle const &circle, Position point);
+    static Circle fromTwo(Position a, Position b);
+    static Circle fromThree(Position a, Position b, Position c);
+    std::mt19937 rng_;
+    std::vector<Position> points_;
+    Circle circle_;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef ENDGAME_HPP
+#define ENDGAME_HPP
+
+#include "Bounds.hpp"
+#include "Simulator.hpp"
+#include "Trace.hpp"
+
+// Exact search for the last few zombies once every human is safe. Ash's
+// play is split into legs that end with the next kill: on every turn of a
+// leg Ash walks to the centroid of the next positions of a chosen subset
+// of the zombies (a single zombie is a chase, the empty set waits in
+// place). Legs are played on the Simulator, so scores follow the referee.
+// Depth-first branch and bound over the sequences of legs, bigger subsets
+// first, returns the best-scoring sequence and, among equal scores, the
+// shortest one. A branch is pruned when its Bounds::tight() score cannot
+// beat the best score found so far; the bound is admissible, so this
+// never cuts the optimum within this move set. Every leg but the last
+// kills a zombie, so the search is at most maxZombies deep and keeps one
+// Simulator per depth, restored from its parent before each leg.
+class EndgameSolver: public MoveAdvisor
+{
+public:
+    static const int maxZombies = 4;
+    static const int maxLegTurns = 40;
+
+    EndgameSolver();
+    bool advise(GameData const &data, Position &move);
+    int solve(GameData const &data);
+    Position getFirstMove();
+    int getBestScore();
+    int getBestTurns();
+    int getNodes();
+    int getPruned();
+private:
+    void search(int depth, Position firstMove);
+    bool playLeg(Simulator &sim, int mask, Position &firstMove);
+    Position legTarget(Simulator &sim, int mask);
+    Simulator states_[maxZombies + 1];
+    GameData boundData_;
+    Position firstMove_;
+    int bestScore_;
+    int bestTurns_;
+    int nodes_;
+    int pruned_;
+};
+
+#endif
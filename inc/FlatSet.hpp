@@ -0,0 +1,88 @@
+#ifndef FLATSET_HPP
+#define FLATSET_HPP
+
+#include <algorithm>
+#include <vector>
+
+// Sorted vector with the subset of the std::set interface used by GameData.
+// clear() keeps the storage, so refilling the set every turn stops
+// allocating once it has grown to the largest turn.
+template <typename T>
+class FlatSet
+{
+public:
+    typedef T value_type;
+    typedef typename std::vector<T>::const_iterator iterator;
+    typedef typename std::vector<T>::const_iterator const_iterator;
+    typedef typename std::vector<T>::const_reverse_iterator reverse_iterator;
+    typedef typename std::vector<T>::const_reverse_iterator
+        const_reverse_iterator;
+
+    const_iterator begin() const { return items_.begin(); }
+    const_iterator end() const { return items_.end(); }
+    const_reverse_iterator rbegin() const { return items_.rbegin(); }
+    const_reverse_iterator rend() const { return items_.rend(); }
+    size_t size() const { return items_.size(); }
+    bool empty() const { return items_.empty(); }
+    void clear() { items_.clear(); }
+    void reserve(size_t n) { items_.reserve(n); }
+
+    std::pair<const_iterator, bool> insert(T const &value)
+    {
+        if (items_.empty() || items_.back() < value)
+        {
+            items_.push_back(value);
+            return std::make_pair(items_.end() - 1, true);
+        }
+        typename std::vector<T>::iterator it =
+            std::lower_bound(items_.begin(), items_.end(), value);
+        if (it != items_.end() && !(value < *it))
+        {
+            return std::make_pair(const_iterator(it), false);
+        }
+        it = items_.insert(it, value);
+        return std::make_pair(const_iterator(it), true);
+    }
+
+    const_iterator insert(const_iterator, T const &value)
+    {
+        return insert(value).first;
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    size_t erase(T const &value)
+    {
+        typename std::vector<T>::iterator it =
+            std::lower_bound(items_.begin(), items_.end(), value);
+        if (it == items_.end() || value < *it)
+            return 0;
+        items_.erase(it);
+        return 1;
+    }
+
+    const_iterator find(T const &value) const
+    {
+        const_iterator it =
+            std::lower_bound(items_.begin(), items_.end(), value);
+        if (it == items_.end() || value < *it)
+            return items_.end();
+        return it;
+    }
+
+    size_t count(T const &value) const
+    {
+        return find(value) != end() ? 1 : 0;
+    }
+private:
+    std::vector<T> items_;
+};
+
+#endif
@@ -1,125 +1,136 @@
+#ifndef GAMECONTROLLER_HPP
+#define GAMECONTROLLER_HPP
+
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <vector>
 #include <algorithm>
-#include <set>
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
 
-struct Position
-{
-    Position();
-    Position(int x, int y);
-    int x_;
-    int y_;
-};
+#include "Cleanup.hpp"
+#include "Clusters.hpp"
+#include "Destination.hpp"
+#include "Enclosing.hpp"
+#include "GameData.hpp"
+#include "Heatmap.hpp"
+#include "HumanQueue.hpp"
+#include "Intercept.hpp"
+#include "Profiler.hpp"
+#include "Rescue.hpp"
+#include "Trajectory.hpp"
 
-struct Human
+class TurnListener
 {
-    Human();
-    Human(int id, Position pos);
-    bool operator<(const Human& rhs) const;
-    int id_;
-    Position pos_;
-    enum Category
-    {
-        OK,
-        Endangered,
-        Lost
-    };
-    mutable Category cat_;
+public:
+    virtual ~TurnListener() {}
+    virtual void onTurn(GameData const &data, Position solution) = 0;
 };
 
-struct Zombie
+// Lets a stronger search take over a turn: advise() returns false when
+// it has nothing better than the built-in strategy.
+class MoveAdvisor
 {
-    Zombie();
-    Zombie(int id, Position pos, Position nextPos);
-    bool operator<(const Zombie& rhs) const;
-    int id_;
-    Position pos_;
-    Position nextPos_;
-    mutable double appealFactor_;
+public:
+    virtual ~MoveAdvisor() {}
+    virtual bool advise(GameData const &data, Position &move) = 0;
 };
 
-struct GameData
+// Keeps a search running while the referee computes the next turn:
+// ponder() is called right after a move is written, collect() as soon as
+// the next input is read. It is asked to advise only while no human is
+// endangered; the rescue strategies keep the turn.
+class Ponderer: public MoveAdvisor
 {
-    Position ashPos_;
-    int humanCount_;
-    std::set<Human> humans_;
-    int zombieCount_;
-    std::set<Zombie> zombies_;
+public:
+    virtual void ponder(GameData const &data, Position move) = 0;
+    virtual void collect(GameData const &data) = 0;
 };
 
-namespace Helpers
-{
-const int ashStepSize = 1000;
-const int zombieStepSize = 400;
-const int shootingRadius = 2000;
-const double zombieFactor = 1;
-const double humanFactor = 1.0;
-const double endangeredFactor = 40.0;
-const double ashFactor = 40.0;
-const double neighbourhoodRadius = 3000;
-double distance(Position p1, Position p2);
-double distance(Position ash, Human human);
-double distance(Position ash, Zombie zombie);
-int steps(Human, Zombie);
-int steps(Human, Position);
-int steps(Position, Zombie);
-}
-
-namespace VectorOpers
-{
-    Position subtract(Position p2, Position p1);
-    Position multiply(Position pos, double n);
-    Position resize(Position pos, double length);
-    Position rotate(Position pos, double angle);
-}
-
-
 class GameController
 {
 public:
+    static const int destinationEvaluations = 128;
+    static const int cleanupEvaluations = 64;
+    // Bigger neighbourhoods are still worth a combo, so they are left to
+    // attackMostDenseZombie() even once every human is safe.
+    static const int cleanupMaxCluster = 4;
+    // A neighbourhood that converges into one shooting range later than
+    // this is left to the centroid heuristic.
+    static const int singleShotHorizon = 6;
+
     GameController();
     ~GameController();
     void startGame();
+    bool runTurn(std::istream& input);
     void loadGameData(std::istream& input);
+    void loadGameData(GameData const &data);
     void writeSolution(Position sol);
+    Position playTurn();
 
     void chooseStrategy();
     void doTheTriage();
-    void doTheTriage(std::set<Human> &humans);
+    void doTheTriage(FlatSet<Human> &humans);
+    HumanQueue &getHumanQueue();
+    ZombieClusters &getClusters();
     bool atLeastOneHumanIsSave();
-    bool atLeastOneHumanIsSave(std::set<Human> const &humans);
+    bool atLeastOneHumanIsSave(FlatSet<Human> const &humans);
+    bool allHumansSafe();
     void rateZombies();
-    void rateZombies(std::set<Zombie> &zombies);
+    void rateZombies(FlatSet<Zombie> &zombies);
 
     Position dumbStrategy();
     Position rescueMissionStrategy();
     Position goToClosestEndangered();
     Position attackMostDenseZombie();
+    Position cleanupStrategy();
 
-    Zombie findNearestZombie(Position pos, std::set<Zombie> const &zombies);
-    Zombie findZombieWithHighestAppealFactor(std::set<Zombie> const &zombies);
-    std::vector<Zombie> selectZombiesFromNeighbourhood(
-        Zombie zombie, std::set<Zombie> const &zombies);
+    Zombie findNearestZombie(Position pos, FlatSet<Zombie> const &zombies);
+    Zombie findZombieWithHighestAppealFactor(FlatSet<Zombie> const &zombies);
+    Position neighbourhoodCenter(Zombie zombie);
     Position centerOfMass(std::vector<Position> const &positions);
     Position centerOfMass(std::vector<Zombie> const &zombies);
     Position calcDestination(Position start, Position vec);
-    int countZombiesInRange(Position pos, std::set<Zombie> const &zombies);
-    double chooseBestAngle(Position vec, std::set<Zombie> const &zombies);
+    int countZombiesInRange(Position pos, FlatSet<Zombie> const &zombies);
+    Position chooseDestination(Position vec);
 
     GameData getData();
-    void debugPrint(GameData data);
+    void setParams(StrategyParams params);
+    StrategyParams getParams();
+    void setVerbose(bool verbose);
+    void setListener(TurnListener* listener);
+    void setAdvisor(MoveAdvisor* advisor);
+    void setPonderer(Ponderer* ponderer);
+    void debugPrint(GameData const &data);
 private:
+    Human::Category triageCategory(int zombieSteps, int ashSteps);
+    bool singleShotAhead(Zombie zombie, Position &goal);
     enum State
     {
         normalMode,
         rescueEndangered,
-        rescueHuman
+        rescueHuman,
+        cleanupMode
     };
     GameData data_;
     State state_;
-};
\ No newline at end of file
+    StrategyParams params_;
+    bool verbose_;
+    TurnListener* listener_;
+    MoveAdvisor* advisor_;
+    Ponderer* ponderer_;
+    HumanQueue humanQueue_;
+    ZombieClusters clusters_;
+    DestinationSearch destinations_;
+    CleanupTour cleanup_;
+    RescueScheduler rescue_;
+    TrajectoryCache trajectories_;
+    EnclosingCircle enclosing_;
+    KillHeatmap heatmap_;
+    std::vector<int> groupIds_;
+    std::vector<RescueTarget> rescueTargets_;
+};
+
+#endif
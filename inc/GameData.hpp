@@ -0,0 +1,90 @@
+#ifndef GAMEDATA_HPP
+#define GAMEDATA_HPP
+
+#include <cmath>
+
+#include "FlatSet.hpp"
+#include "TunedParams.hpp"
+
+struct Position
+{
+    Position();
+    Position(int x, int y);
+    int x_;
+    int y_;
+};
+
+struct Human
+{
+    Human();
+    Human(int id, Position pos);
+    bool operator<(const Human& rhs) const;
+    int id_;
+    Position pos_;
+    enum Category
+    {
+        OK,
+        Endangered,
+        Lost
+    };
+    mutable Category cat_;
+};
+
+struct Zombie
+{
+    Zombie();
+    Zombie(int id, Position pos, Position nextPos);
+    bool operator<(const Zombie& rhs) const;
+    int id_;
+    Position pos_;
+    Position nextPos_;
+    mutable double appealFactor_;
+};
+
+struct GameData
+{
+    Position ashPos_;
+    int humanCount_;
+    FlatSet<Human> humans_;
+    int zombieCount_;
+    FlatSet<Zombie> zombies_;
+};
+
+namespace Helpers
+{
+const int ashStepSize = 1000;
+const int zombieStepSize = 400;
+const int shootingRadius = 2000;
+const int mapWidth = 16000;
+const int mapHeight = 9000;
+const int maxHumans = 99;
+const int maxZombies = 99;
+double distance(Position p1, Position p2);
+double distance(Position ash, Human human);
+double distance(Position ash, Zombie zombie);
+int steps(Human, Zombie);
+int steps(Human, Position);
+int steps(Position, Zombie);
+Position move(Position from, Position to, int stepSize);
+}
+
+struct StrategyParams
+{
+    StrategyParams();
+    double zombieFactor_;
+    double humanFactor_;
+    double endangeredFactor_;
+    double ashFactor_;
+    double neighbourhoodRadius_;
+    int endangeredSteps_;
+};
+
+namespace VectorOpers
+{
+    Position subtract(Position p2, Position p1);
+    Position multiply(Position pos, double n);
+    Position resize(Position pos, double length);
+    Position rotate(Position pos, double angle);
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef HUMANQUEUE_HPP
+#define HUMANQUEUE_HPP
+
+#include "GameData.hpp"
+#include "Profiler.hpp"
+
+// Indexed min-heap of humans keyed by the turns until their nearest zombie
+// reaches them, together with the turns Ash needs to cover them: walking
+// into range of the human or intercepting that zombie, whichever is first.
+// Nearest zombies are tracked kinetically: every human keeps a lower bound
+// on the distance to all other zombies, which shrinks by the longest zombie
+// move since the last update, and only humans whose nearest zombie died or
+// may have been passed rescan the zombies. Keys change for every human each
+// turn, so update() refreshes them in place and re-heapifies in O(H).
+// Inputs that are not consecutive turns rebuild it.
+class HumanQueue
+{
+public:
+    struct Entry
+    {
+        int humanId_;
+        int deathTurns_;
+        int coverTurns_;
+        int nearestZombie_;
+        double secondBound_;
+    };
+
+    HumanQueue();
+    void update(GameData const &data);
+    void clear();
+    int size();
+    bool empty();
+    Entry const &top();
+    Entry const &at(int index);
+    Entry const* find(int humanId);
+    int getRescans();
+private:
+    bool isConsecutive(GameData const &data, double &maxMove);
+    void rescan(Entry &entry, Human const &human, GameData const &data);
+    void siftDown(int index);
+    bool before(int a, int b);
+    void swapEntries(int a, int b);
+    std::vector<Entry> heap_;
+    std::vector<int> index_;
+    std::vector<Position> zombiePos_;
+    std::vector<bool> zombieAlive_;
+    int rescans_;
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef INTERCEPT_HPP
+#define INTERCEPT_HPP
+
+#include <vector>
+
+#include "GameData.hpp"
+
+struct Interception
+{
+    int turns_;
+    Position point_;
+};
+
+// Earliest turn t at which Ash, moving 1000 units per turn, has a zombie
+// within shooting range while the zombie keeps walking along its current
+// heading (pos_ -> nextPos_). With D = zombie - ash and v the zombie step,
+// |D + v*t| <= 2000 + 1000*t is a quadratic in t whose leading coefficient
+// |v|^2 - 1000^2 is negative, so it holds from its larger root onwards.
+// point_ is where the zombie stands on that turn.
+namespace Intercept
+{
+double earliestTime(Position ash, Position zombie, Position velocity);
+Interception solve(Position ash, Zombie const &zombie);
+void solveAll(Position ash, FlatSet<Zombie> const &zombies,
+    std::vector<Interception> &out);
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <cstdint>
+#include <string>
+
+// Hardware counters of the calling thread read through Linux perf_event_open.
+// Counters the kernel or the CPU does not provide stay unavailable and read
+// as zero, so benchmarks still run inside VMs and on other systems. The
+// events are opened as one group so they count over the same interval; when
+// the kernel multiplexes the group with other users of the PMU the values
+// are scaled up by the enabled/running time ratio.
+class PerfCounters
+{
+public:
+    enum Event
+    {
+        cycles,
+        instructions,
+        l1dMisses,
+        llcMisses,
+        branchMisses,
+        eventCount
+    };
+    struct Sample
+    {
+        uint64_t values_[eventCount];
+        uint64_t timeEnabled_;
+        uint64_t timeRunning_;
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+    bool isAvailable(Event event);
+    bool anyAvailable();
+    void start();
+    Sample stop();
+    static const char* eventName(Event event);
+private:
+    PerfCounters(PerfCounters const &);
+    PerfCounters &operator=(PerfCounters const &);
+    int openEvent(Event event, uint32_t type, uint64_t config);
+    int fds_[eventCount];
+    int leader_;
+    int members_;
+    Event order_[eventCount];
+};
+
+#endif
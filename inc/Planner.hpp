@@ -0,0 +1,50 @@
+#ifndef PLANNER_HPP
+#define PLANNER_HPP
+
+#include <atomic>
+#include <chrono>
+
+#include "Arena.hpp"
+#include "Simulator.hpp"
+#include "Trace.hpp"
+
+// Anytime Monte Carlo search over Ash's moves. Each rollout plays a few
+// random legs and then chases the nearest zombie until the simulated game
+// ends; the best sequence found so far is kept, shifted by one turn after
+// every move, and mutated in later searches. search() returns when the
+// time budget is spent, the iteration limit is reached or stop() was
+// called; a stop() holds until resume(), so a search started on another
+// thread cannot miss it, and it also cuts the running rollout short.
+// plan() resumes, searches and takes the first move. Rollouts restore a
+// member Simulator from the root and play their moves in a buffer from an
+// arena reset by every search, so a warmed-up search does not allocate.
+class Planner
+{
+public:
+    Planner(unsigned seed = 1);
+    void reset();
+    Position plan(GameData const &data, double budgetMs);
+    void search(GameData const &data, double budgetMs);
+    void setMaxIterations(int maxIterations);
+    void stop();
+    void resume();
+    int getIterations();
+    int getBestScore();
+    std::vector<Position> getBestPlan();
+private:
+    int rollout(ScratchVector<Position> &moves);
+    void randomLegs(ScratchVector<Position> &moves);
+    void mutate(ScratchVector<Position> &moves);
+    Position randomPosition();
+    std::mt19937 rng_;
+    Simulator root_;
+    Simulator sim_;
+    Arena arena_;
+    std::vector<Position> best_;
+    int bestScore_;
+    int iterations_;
+    int maxIterations_;
+    std::atomic<bool> stop_;
+};
+
+#endif
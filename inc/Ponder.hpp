@@ -0,0 +1,72 @@
+#ifndef PONDER_HPP
+#define PONDER_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Divergence.hpp"
+#include "Endgame.hpp"
+#include "Planner.hpp"
+
+// Runs the Planner on a background thread while the live loop waits for
+// the referee. ponder() predicts the next input by stepping the Simulator
+// with the move just written and hands that state to the worker, which
+// plays the built-in strategy out from it and then searches; collect()
+// stops the worker and keeps both results only if the real input matches
+// the prediction, otherwise the planner starts over. A plan the built-in
+// strategy did not follow is dropped before pondering. advise() tops the
+// kept search up and takes over only while its best line outscores the
+// built-in strategy; when no pondered baseline is at hand the playout
+// runs first, and everything stops at the turn budget. The worker thread
+// lives as long as the planner, so a warmed-up turn does not allocate.
+class PonderingPlanner: public Ponderer
+{
+public:
+    static const int defaultTurnBudgetMs = 40;
+    static const int maxPonderMs = 1000;
+
+    PonderingPlanner(double turnBudgetMs = defaultTurnBudgetMs,
+        unsigned seed = 1);
+    ~PonderingPlanner();
+    void ponder(GameData const &data, Position move);
+    void collect(GameData const &data);
+    bool advise(GameData const &data, Position &move);
+    void report(std::ostream &out);
+    Planner &getPlanner();
+    int getHits();
+    int getMisses();
+    int getPonderedRollouts();
+    int getPlannedTurns();
+private:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    void work();
+    void join();
+    int playBaseline(GameData const &data, TimePoint deadline);
+    Planner planner_;
+    DivergenceMonitor monitor_;
+    GameController baselineGame_;
+    EndgameSolver baselineEndgame_;
+    Simulator baselineSim_;
+    GameData baselineData_;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    bool pondering_;
+    bool quit_;
+    bool pondered_;
+    std::atomic<bool> stop_;
+    int predictedBaseline_;
+    int baseline_;
+    Position planned_;
+    bool hasPlan_;
+    double turnBudgetMs_;
+    int hits_;
+    int misses_;
+    int ponderedRollouts_;
+    int plannedTurns_;
+};
+
+#endif
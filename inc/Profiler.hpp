@@ -0,0 +1,100 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include "Trace.hpp"
+
+// Off unless the build asks for it, so the submission bundle carries no
+// timers or counters; CMake defines PROFILING=1 for the local targets.
+#ifndef PROFILING
+#define PROFILING 0
+#endif
+
+#if PROFILING
+#define PROFILE_PHASE(phase) \
+    Profiler::ScopedTimer phaseTimer(Profiler::phase)
+#define PROFILE_COUNT(counter, n) \
+    Profiler::count(Profiler::counter, n)
+#else
+#define PROFILE_PHASE(phase)
+#define PROFILE_COUNT(counter, n)
+#endif
+
+namespace Profiler
+{
+enum Phase
+{
+    loadGameData,
+    chooseStrategy,
+    doTheTriage,
+    rateZombies,
+    attackMostDenseZombie,
+    searchDestination,
+    planCleanup,
+    writeSolution,
+    phaseCount
+};
+
+enum Counter
+{
+    distanceEvaluations,
+    zombiesScanned,
+    humansScanned,
+    counterCount
+};
+
+const int histogramBuckets = 40;
+
+struct PhaseStats
+{
+    uint64_t calls_;
+    uint64_t totalNs_;
+    uint64_t maxNs_;
+    uint64_t histogram_[histogramBuckets];
+};
+
+struct Stats
+{
+    PhaseStats phases_[phaseCount];
+    uint64_t counters_[counterCount];
+};
+
+extern thread_local Stats stats;
+
+const char* phaseName(Phase phase);
+const char* counterName(Counter counter);
+void record(Phase phase, uint64_t ns);
+void reset();
+void report(std::ostream &out);
+
+inline void count(Counter counter, uint64_t n)
+{
+    stats.counters_[counter] += n;
+}
+
+class ScopedTimer
+{
+public:
+    ScopedTimer(Phase phase):
+        phase_(phase), start_(std::chrono::steady_clock::now())
+    {}
+    ~ScopedTimer()
+    {
+        std::chrono::steady_clock::time_point end =
+            std::chrono::steady_clock::now();
+        record(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+            end - start_).count());
+        if (Trace::isEnabled())
+            Trace::complete(phaseName(phase_), "phase", start_, end);
+    }
+private:
+    Phase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+
+#include "GameController.hpp"
+
+// Replay log layout: "CVZR" magic and a version byte, followed by records.
+// A game record resets the delta state, every turn record holds the turn
+// input and the chosen solution. Numbers are LEB128 varints, signed ones
+// zigzag encoded. Ash and the solution are stored relative to the previous
+// Ash position, humans relative to the same human in the previous turn,
+// zombies relative to the nextPos reported for them in the previous turn.
+namespace Replay
+{
+const char magic[] = "CVZR";
+const unsigned char version = 1;
+const unsigned char gameRecord = 'G';
+const unsigned char turnRecord = 'T';
+}
+
+class ReplayWriter
+{
+public:
+    ReplayWriter();
+    ~ReplayWriter();
+    bool open(std::string const &path);
+    void close();
+    void beginGame();
+    void writeTurn(GameData const &data, Position solution);
+    uint64_t getBytesWritten();
+private:
+    void putUnsigned(uint64_t value);
+    void putSigned(int64_t value);
+    void flush();
+    std::ofstream out_;
+    std::vector<unsigned char> buffer_;
+    Position prevAsh_;
+    std::vector<Human> prevHumans_;
+    std::vector<Zombie> prevZombies_;
+    bool pendingGame_;
+    uint64_t bytesWritten_;
+};
+
+class ReplayReader
+{
+public:
+    ReplayReader();
+    ~ReplayReader();
+    bool open(std::string const &path);
+    void close();
+    void rewind();
+    bool next(GameData &data, Position &solution);
+    bool isNewGame();
+    uint64_t getSize();
+private:
+    uint64_t getUnsigned();
+    int64_t getSigned();
+    int fd_;
+    const unsigned char* begin_;
+    const unsigned char* end_;
+    const unsigned char* pos_;
+    bool valid_;
+    bool newGame_;
+    Position prevAsh_;
+    std::vector<Human> prevHumans_;
+    std::vector<Zombie> prevZombies_;
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef RESCUE_HPP
+#define RESCUE_HPP
+
+#include <vector>
+
+#include "GameData.hpp"
+#include "Intercept.hpp"
+
+// intercept_ is Ash's interception of the zombie threatening the human,
+// with noIntercept turns when there is none to aim at.
+struct RescueTarget
+{
+    static const int noIntercept = 1 << 20;
+
+    int humanId_;
+    Position pos_;
+    int deadline_;
+    Interception intercept_;
+};
+
+struct RescuePlan
+{
+    std::vector<int> order_;
+    std::vector<Position> waypoints_;
+    int saved_;
+    int turns_;
+};
+
+// Orders the rescue of endangered humans. Ash walks from human to human;
+// a human is saved when Ash gets within shooting range of it before its
+// deadline (the turn its nearest zombie arrives). A first human Ash cannot
+// reach in time is still saved when he can shoot its zombie on the way;
+// that stop then aims at the interception point and the walk goes on
+// from the human as if he had reached it. The plan saves as many
+// humans as possible and, among those plans, takes the fewest turns. Up
+// to exactLimit targets are solved exactly with a DP over (saved set, last
+// human), which keeps only the previous human of each state; larger sets
+// use earliest-deadline-first plus 2-opt. The DP tables for exactLimit
+// targets take about 240 KB and 12 targets solve in well under a
+// millisecond. Buffers are reserved for the largest sets up front, so the
+// scheduler does not allocate while playing.
+class RescueScheduler
+{
+public:
+    static const int exactLimit = 12;
+
+    RescueScheduler();
+    RescuePlan const &schedule(Position ash,
+        std::vector<RescueTarget> const &targets);
+    RescuePlan const &scheduleExact(Position ash,
+        std::vector<RescueTarget> const &targets);
+    RescuePlan const &scheduleGreedy(Position ash,
+        std::vector<RescueTarget> const &targets);
+private:
+    static int coverTurns(Position from, Position to);
+    static int walkTurns(Position from, Position to);
+    static bool intercepts(Position ash, RescueTarget const &target);
+    int walkRoute(Position ash, std::vector<RescueTarget> const &targets,
+        std::vector<int> const &order, int &turns, bool record);
+    void addStop(int humanId, Position waypoint);
+    std::vector<int> cover_;
+    std::vector<int> walk_;
+    std::vector<int> best_;
+    std::vector<signed char> parent_;
+    std::vector<int> route_;
+    std::vector<int> candidate_;
+    RescuePlan plan_;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef SIMULATOR_HPP
+#define SIMULATOR_HPP
+
+#include <random>
+
+#include "GameController.hpp"
+
+namespace Rules
+{
+const int mapWidth = Helpers::mapWidth;
+const int mapHeight = Helpers::mapHeight;
+const int maxTurns = 200;
+const int maxHumans = Helpers::maxHumans;
+int comboMultiplier(int killIndex);
+int killScore(int humansAlive, int killIndex);
+Position move(Position from, Position to, int stepSize);
+}
+
+class Simulator
+{
+public:
+    Simulator();
+    Simulator(GameData const &data);
+    void load(GameData const &data);
+    void reserve(int humans, int zombies);
+    void step(Position target);
+    bool isOver();
+    int getScore();
+    int getTurn();
+    int getHumansAlive();
+    int getZombiesAlive();
+    Zombie getZombie(int index);
+    Position getAshPos();
+    Position nearestZombie();
+    GameData getData();
+    void getData(GameData &data);
+
+    static GameData loadScenario(std::string const &path);
+    static GameData randomScenario(int humans, int zombies, unsigned seed);
+    static int playGame(GameData const &scenario, StrategyParams params);
+private:
+    Position findTarget(Position zombiePos);
+    Position ashPos_;
+    std::vector<Human> humans_;
+    std::vector<Zombie> zombies_;
+    int score_;
+    int turn_;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define TRACE_SCOPE(name, category) \
+    Trace::Scope traceScope(name, category)
+
+// Chrome trace-event recorder. Events are appended to a buffer owned by the
+// calling thread and written as JSON only when tracing stops (at exit), so
+// the traced code never waits for I/O. The buffers are read without the
+// threads' cooperation, so stop() must run once every other traced thread
+// has been joined; programs with worker threads call it themselves.
+namespace Trace
+{
+typedef std::chrono::steady_clock::time_point TimePoint;
+
+struct Event
+{
+    const char* name_;
+    const char* category_;
+    char phase_;
+    int64_t ts_;
+    int64_t dur_;
+    int64_t value_;
+};
+
+// Read from every traced thread (the ponder thread included) while the
+// main thread may start or stop tracing; the relaxed loads keep it cheap.
+extern std::atomic<bool> enabled;
+
+inline bool isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+bool start(std::string const &path);
+bool startFromEnv();
+void stop();
+void setThreadName(std::string const &name);
+void complete(const char* name, const char* category,
+    TimePoint begin, TimePoint end);
+void instant(const char* name, const char* category);
+void counter(const char* name, int64_t value);
+
+class Scope
+{
+public:
+    Scope(const char* name, const char* category):
+        name_(name), category_(category),
+        begin_(isEnabled() ? std::chrono::steady_clock::now() : TimePoint())
+    {}
+    ~Scope()
+    {
+        if (isEnabled())
+            complete(name_, category_, begin_, std::chrono::steady_clock::now());
+    }
+private:
+    const char* name_;
+    const char* category_;
+    TimePoint begin_;
+};
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef TRAJECTORY_HPP
+#define TRAJECTORY_HPP
+
+#include "GameData.hpp"
+
+// Predicted zombie paths for the next turns, assuming Ash stands still:
+// every zombie walks straight at its nearest target (a human, or Ash on
+// ties) at 400 units per turn, so the target never changes on the way.
+// update() keeps a path and only shifts it by one turn unless the zombie
+// left the path, its human was eaten, Ash became the nearer target, or
+// Ash moved while being the target.
+class TrajectoryCache
+{
+public:
+    static const int ashTarget = -1;
+
+    TrajectoryCache(int horizon = 20);
+    void update(GameData const &data);
+    void clear();
+    Position positionAt(int zombieId, int turn);
+    int turnsToTarget(int zombieId);
+    int getTargetId(int zombieId);
+    Position getTarget(int zombieId);
+    bool isTracked(int zombieId);
+    int getHorizon();
+    int getRecomputed();
+private:
+    struct Entry
+    {
+        Entry();
+        bool alive_;
+        bool seen_;
+        int targetId_;
+        Position target_;
+        int offset_;
+        std::vector<Position> path_;
+    };
+    bool stillValid(Entry &entry, Zombie const &zombie, GameData const &data);
+    void recompute(Entry &entry, Zombie const &zombie, GameData const &data);
+    void extend(Entry &entry, int turns);
+    std::vector<Entry> entries_;
+    Position ashPos_;
+    int horizon_;
+    int recomputed_;
+};
+
+#endif
@@ -0,0 +1,15 @@
+// Generated by tools/tuner - do not edit by hand.
+#ifndef TUNEDPARAMS_HPP
+#define TUNEDPARAMS_HPP
+
+namespace Helpers
+{
+const double zombieFactor = 1;
+const double humanFactor = 1.0;
+const double endangeredFactor = 40.0;
+const double ashFactor = 40.0;
+const double neighbourhoodRadius = 3000;
+const int endangeredSteps = 2;
+}
+
+#endif
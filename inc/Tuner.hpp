@@ -0,0 +1,52 @@
+#ifndef TUNER_HPP
+#define TUNER_HPP
+
+#include <random>
+
+#include "Simulator.hpp"
+
+class CmaEs
+{
+public:
+    CmaEs(std::vector<double> const &mean, double sigma,
+        int lambda, unsigned seed);
+    std::vector<std::vector<double> > ask();
+    void tell(std::vector<std::vector<double> > const &candidates,
+        std::vector<double> const &costs);
+    std::vector<double> getMean();
+    double getSigma();
+    int getLambda();
+private:
+    void decompose();
+    int n_;
+    int lambda_;
+    int mu_;
+    std::vector<double> weights_;
+    double mueff_;
+    double cc_;
+    double cs_;
+    double c1_;
+    double cmu_;
+    double damps_;
+    double chiN_;
+    int generation_;
+    std::vector<double> mean_;
+    double sigma_;
+    std::vector<double> pc_;
+    std::vector<double> ps_;
+    std::vector<std::vector<double> > C_;
+    std::vector<std::vector<double> > B_;
+    std::vector<double> D_;
+    std::mt19937 rng_;
+};
+
+namespace Tuner
+{
+std::vector<double> encode(StrategyParams const &params);
+StrategyParams decode(std::vector<double> const &x);
+std::vector<double> evaluate(std::vector<StrategyParams> const &candidates,
+    std::vector<GameData> const &corpus, unsigned threads);
+void writeHeader(std::ostream &out, StrategyParams const &params);
+}
+
+#endif
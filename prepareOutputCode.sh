@@ -1,4 +1,42 @@
 echo "" > output.cpp
-cat inc/GameController.hpp > output.cpp
+cat inc/TunedParams.hpp >> output.cpp
+cat inc/Arena.hpp >> output.cpp
+cat inc/FlatSet.hpp >> output.cpp
+cat inc/Trace.hpp >> output.cpp
+cat inc/Profiler.hpp | grep -v "#include \"" >> output.cpp
+cat inc/GameData.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Clusters.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Trajectory.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Heatmap.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Enclosing.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Destination.hpp | grep -v "#include \"" >> output.cpp
+cat inc/HumanQueue.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Intercept.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Cleanup.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Rescue.hpp | grep -v "#include \"" >> output.cpp
+cat inc/GameController.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Simulator.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Divergence.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Bounds.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Endgame.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Planner.hpp | grep -v "#include \"" >> output.cpp
+cat inc/Ponder.hpp | grep -v "#include \"" >> output.cpp
+cat src/Trace.cpp | grep -v "#include" >> output.cpp
+cat src/Profiler.cpp | grep -v "#include" >> output.cpp
+cat src/Clusters.cpp | grep -v "#include" >> output.cpp
+cat src/Trajectory.cpp | grep -v "#include" >> output.cpp
+cat src/Heatmap.cpp | grep -v "#include" >> output.cpp
+cat src/Enclosing.cpp | grep -v "#include" >> output.cpp
+cat src/Destination.cpp | grep -v "#include" >> output.cpp
+cat src/HumanQueue.cpp | grep -v "#include" >> output.cpp
+cat src/Intercept.cpp | grep -v "#include" >> output.cpp
+cat src/Cleanup.cpp | grep -v "#include" >> output.cpp
+cat src/Rescue.cpp | grep -v "#include" >> output.cpp
 cat src/GameController.cpp | grep -v "#include" >> output.cpp
+cat src/Simulator.cpp | grep -v "#include" >> output.cpp
+cat src/Divergence.cpp | grep -v "#include" >> output.cpp
+cat src/Bounds.cpp | grep -v "#include" >> output.cpp
+cat src/Endgame.cpp | grep -v "#include" >> output.cpp
+cat src/Planner.cpp | grep -v "#include" >> output.cpp
+cat src/Ponder.cpp | grep -v "#include" >> output.cpp
 cat src/main.cpp | grep -v "#include" >> output.cpp
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "AllocCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace
+{
+atomic<uint64_t> allocationCount(0);
+atomic<uint64_t> allocatedBytes(0);
+
+void* allocate(size_t size)
+{
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    allocatedBytes.fetch_add(size, memory_order_relaxed);
+    void* ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == NULL)
+        throw bad_alloc();
+    return ptr;
+}
+}
+
+uint64_t AllocCounter::allocations()
+{
+    return allocationCount.load(memory_order_relaxed);
+}
+
+uint64_t AllocCounter::bytes()
+{
+    return allocatedBytes.load(memory_order_relaxed);
+}
+
+void AllocCounter::reset()
+{
+    allocationCount.store(0, memory_order_relaxed);
+    allocatedBytes.store(0, memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(size_t size, nothrow_t const &) noexcept
+{
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    allocatedBytes.fetch_add(size, memory_order_relaxed);
+    return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, nothrow_t const &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
@@ -0,0 +1,101 @@
+#include "Bounds.hpp"
+
+using namespace std;
+
+namespace
+{
+const int never = 1 << 29;
+// Flooring can stretch or shorten each step by up to sqrt(2).
+const int roundingSlack = 2;
+const int closingSpeed = Helpers::ashStepSize + Helpers::zombieStepSize;
+}
+
+int Bounds::comboValue(int humansAlive, int kills)
+{
+    int value = 0;
+    for (int kill = 1; kill <= kills; kill++)
+    {
+        value += Rules::killScore(humansAlive, kill);
+    }
+    return value;
+}
+
+int Bounds::loose(int score, int humansAlive, int zombiesAlive)
+{
+    return score + comboValue(humansAlive, zombiesAlive);
+}
+
+int Bounds::loose(Simulator &sim)
+{
+    return loose(sim.getScore(), sim.getHumansAlive(), sim.getZombiesAlive());
+}
+
+int Bounds::tight(GameData const &data, int score)
+{
+    if (data.humans_.empty())
+        return 0;
+    if (data.zombies_.empty())
+        return score;
+    int firstShot = never;
+    for (auto const &zombie: data.zombies_)
+    {
+        firstShot = min(firstShot, earliestKill(data.ashPos_, zombie.pos_));
+    }
+    int humansAlive = 0;
+    int survivors = 0;
+    for (auto const &human: data.humans_)
+    {
+        int death = certainDeath(data, human);
+        if (death >= firstShot)
+            humansAlive++;
+        if (death == never)
+            survivors++;
+    }
+    if (survivors == 0)
+        return 0;
+    return loose(score, humansAlive, data.zombies_.size());
+}
+
+int Bounds::tight(Simulator &sim)
+{
+    if (sim.isOver())
+        return sim.getScore();
+    return tight(sim.getData(), sim.getScore());
+}
+
+int Bounds::earliestKill(Position ash, Position zombie)
+{
+    double gap = Helpers::distance(ash, zombie) - Helpers::shootingRadius;
+    return max(1, int(ceil(gap/closingSpeed)));
+}
+
+int Bounds::certainDeath(GameData const &data, Human const &human)
+{
+    int death = never;
+    for (auto const &zombie: data.zombies_)
+    {
+        double toHuman = Helpers::distance(zombie.pos_, human.pos_);
+        int arrival = ceil(toHuman/Helpers::zombieStepSize);
+        if (arrival >= death)
+            continue;
+        double toAsh = Helpers::distance(zombie.pos_, data.ashPos_);
+        if (toAsh - toHuman <= (Helpers::ashStepSize + roundingSlack)*arrival)
+            continue;
+        if (toAsh - (closingSpeed + roundingSlack)*arrival
+            <= Helpers::shootingRadius)
+            continue;
+        bool nearest = true;
+        for (auto const &other: data.humans_)
+        {
+            if (other.id_ != human.id_ && Helpers::distance(zombie.pos_,
+                other.pos_) - toHuman <= roundingSlack*arrival)
+            {
+                nearest = false;
+                break;
+            }
+        }
+        if (nearest)
+            death = arrival;
+    }
+    return death;
+}
@@ -0,0 +1,244 @@
+#include "Cleanup.hpp"
+
+using namespace std;
+
+namespace
+{
+long long squaredLength(Position from, Position to)
+{
+    long long x = to.x_ - from.x_;
+    long long y = to.y_ - from.y_;
+    return x*x + y*y;
+}
+
+bool inShootingRange(Position ash, Position zombie)
+{
+    long long range = Helpers::shootingRadius;
+    return squaredLength(ash, zombie) <= range*range;
+}
+}
+
+const int CleanupTour::unbounded;
+
+bool CleanupTour::Cost::operator<(Cost const &rhs) const
+{
+    if (turns_ != rhs.turns_)
+        return turns_ < rhs.turns_;
+    return killTurns_ < rhs.killTurns_;
+}
+
+CleanupTour::CleanupTour(): evaluations_(0)
+{
+    cost_.turns_ = 0;
+    cost_.killTurns_ = 0;
+}
+
+int CleanupTour::plan(GameData const &data, int maxEvaluations)
+{
+    ash_ = data.ashPos_;
+    firstMove_ = ash_;
+    evaluations_ = 0;
+    zombies_.assign(data.zombies_.begin(), data.zombies_.end());
+    targets_.clear();
+    arrivals_.clear();
+    for (auto const &zombie: zombies_)
+    {
+        Position target = ash_;
+        long long minDist = squaredLength(zombie.pos_, ash_);
+        for (auto const &human: data.humans_)
+        {
+            long long dist = squaredLength(zombie.pos_, human.pos_);
+            if (dist < minDist)
+            {
+                minDist = dist;
+                target = human.pos_;
+            }
+        }
+        targets_.push_back(target);
+        arrivals_.push_back(ceil(sqrt(double(minDist))/Helpers::zombieStepSize));
+    }
+    cost_.turns_ = 0;
+    cost_.killTurns_ = 0;
+    if (zombies_.empty())
+        return 0;
+    nearestFirst();
+    cost_ = evaluate(order_, firstMove_, unbounded);
+    improve(maxEvaluations);
+    return cost_.turns_;
+}
+
+Position CleanupTour::getFirstMove()
+{
+    return firstMove_;
+}
+
+int CleanupTour::getTurns()
+{
+    return cost_.turns_;
+}
+
+int CleanupTour::getEvaluations()
+{
+    return evaluations_;
+}
+
+CleanupTour::Cost CleanupTour::evaluate(vector<int> const &order,
+    Position &firstMove, int maxTurns)
+{
+    evaluations_++;
+    killed_.assign(zombies_.size(), 0);
+    Cost cost = {0, 0};
+    Position ash = ash_;
+    bool first = true;
+    for (auto index: order)
+    {
+        if (killed_[index])
+            continue;
+        Position stop;
+        cost.turns_ += stopTurns(ash, index, cost.turns_, stop);
+        if (first)
+            firstMove = stop;
+        first = false;
+        ash = stop;
+        killed_[index] = 1;
+        if (cost.turns_ > maxTurns)
+            break;
+        cost.killTurns_ += (1 + coverAt(ash, cost.turns_))*cost.turns_;
+    }
+    return cost;
+}
+
+void CleanupTour::nearestFirst()
+{
+    int n = zombies_.size();
+    killed_.assign(n, 0);
+    order_.clear();
+    Position ash = ash_;
+    int turn = 0;
+    while (int(order_.size()) < n)
+    {
+        int best = -1;
+        int bestTurns = 0;
+        Position bestStop;
+        for (int index = 0; index < n; index++)
+        {
+            if (killed_[index])
+                continue;
+            Position stop;
+            int turns = stopTurns(ash, index, turn, stop);
+            if (best < 0 || turns < bestTurns)
+            {
+                best = index;
+                bestTurns = turns;
+                bestStop = stop;
+            }
+        }
+        // Zombies swept up at a stop follow it in the order, where the
+        // evaluation skips them as long as the stops before stay put.
+        turn += bestTurns;
+        ash = bestStop;
+        killed_[best] = 1;
+        order_.push_back(best);
+        for (int index = 0; index < n; index++)
+        {
+            if (killed_[index])
+                continue;
+            if (inShootingRange(ash, zombieAt(index, turn)))
+            {
+                killed_[index] = 1;
+                order_.push_back(index);
+            }
+        }
+    }
+}
+
+void CleanupTour::improve(int maxEvaluations)
+{
+    int n = order_.size();
+    bool improved = true;
+    while (improved)
+    {
+        improved = false;
+        for (int i = 0; i + 1 < n; i++)
+        {
+            for (int j = i + 1; j < n; j++)
+            {
+                if (evaluations_ >= maxEvaluations)
+                    return;
+                candidate_ = order_;
+                reverse(candidate_.begin() + i, candidate_.begin() + j + 1);
+                if (tryCandidate())
+                {
+                    improved = true;
+                    continue;
+                }
+                if (evaluations_ >= maxEvaluations)
+                    return;
+                candidate_ = order_;
+                rotate(candidate_.begin() + i, candidate_.begin() + j,
+                    candidate_.begin() + j + 1);
+                improved = tryCandidate() || improved;
+            }
+        }
+    }
+}
+
+bool CleanupTour::tryCandidate()
+{
+    Position firstMove;
+    Cost cost = evaluate(candidate_, firstMove, cost_.turns_);
+    if (!(cost < cost_))
+        return false;
+    cost_ = cost;
+    firstMove_ = firstMove;
+    order_.swap(candidate_);
+    return true;
+}
+
+Position CleanupTour::zombieAt(int index, int turn)
+{
+    if (turn >= arrivals_[index])
+        return targets_[index];
+    return Helpers::move(zombies_[index].pos_, targets_[index],
+        turn*Helpers::zombieStepSize);
+}
+
+// Turns from turn until the zombie is in range of Ash, at least one since
+// shots only follow a move; stop is where Ash should stand by then, the
+// nearest point in range on the way to the interception point. A zombie
+// that would reach its target first is intercepted standing there.
+int CleanupTour::stopTurns(Position ash, int index, int turn, Position &stop)
+{
+    int id = zombies_[index].id_;
+    Interception interception = Intercept::solve(ash,
+        Zombie(id, zombieAt(index, turn), zombieAt(index, turn + 1)));
+    if (turn + interception.turns_ > arrivals_[index])
+    {
+        Position target = targets_[index];
+        interception = Intercept::solve(ash, Zombie(id, target, target));
+    }
+    double dist = Helpers::distance(ash, interception.point_);
+    stop = ash;
+    if (dist > Helpers::shootingRadius)
+    {
+        stop = Helpers::move(ash, interception.point_,
+            ceil(dist - Helpers::shootingRadius) + 1);
+    }
+    return max(interception.turns_, 1);
+}
+
+int CleanupTour::coverAt(Position ash, int turn)
+{
+    int covered = 0;
+    for (unsigned index = 0; index < zombies_.size(); index++)
+    {
+        if (killed_[index])
+            continue;
+        if (inShootingRange(ash, zombieAt(index, turn)))
+        {
+            killed_[index] = 1;
+            covered++;
+        }
+    }
+    return covered;
+}
@@ -0,0 +1,304 @@
+#include "Clusters.hpp"
+
+using namespace std;
+
+namespace
+{
+// Cells may be larger than the radius without losing pairs; this keeps a
+// tiny radius from asking for a huge grid.
+const int maxCellsPerSide = 128;
+}
+
+ZombieClusters::ZombieClusters()
+    : radius_(0), cellSize_(1), reach_(1), columns_(1), rows_(1),
+    points_(&arena_), ids_(&arena_), neighbours_(&arena_), cells_(&arena_),
+    cellStart_(&arena_), cellItems_(&arena_), parent_(&arena_),
+    clusterByIndex_(&arena_), clusterById_(&arena_), sizes_(&arena_),
+    sumX_(&arena_), sumY_(&arena_)
+{
+}
+
+ZombieClusters::ZombieClusters(ZombieClusters const &): ZombieClusters()
+{
+}
+
+ZombieClusters &ZombieClusters::operator=(ZombieClusters const &)
+{
+    clear();
+    return *this;
+}
+
+void ZombieClusters::build(FlatSet<Zombie> const &zombies, double radius)
+{
+    int n = zombies.size();
+    radius_ = radius;
+    // With cells whose diagonal is shorter than the radius every zombie in
+    // a cell links to every other one, so only pairs of distinct cells up
+    // to reach_ cells apart need distance checks.
+    cellSize_ = max(radius/sqrt(2.0) - 1,
+        double(Helpers::mapWidth)/maxCellsPerSide);
+    cellSize_ = max(cellSize_, 1.0);
+    reach_ = max(int(ceil(radius/cellSize_)), 1);
+    columns_ = Helpers::mapWidth/cellSize_ + 1;
+    rows_ = Helpers::mapHeight/cellSize_ + 1;
+    bool cellsLinked = cellSize_*sqrt(2.0) < radius;
+
+    arena_.reset();
+    renew(points_);
+    renew(ids_);
+    renew(neighbours_);
+    renew(cells_);
+    renew(cellStart_);
+    renew(cellItems_);
+    renew(parent_);
+    renew(clusterByIndex_);
+    renew(clusterById_);
+    renew(sizes_);
+    renew(sumX_);
+    renew(sumY_);
+    points_.reserve(n);
+    ids_.reserve(n);
+    cells_.reserve(n);
+    neighbours_.reserve(n);
+    parent_.resize(n);
+    int maxId = -1;
+    for (auto const &zombie: zombies)
+    {
+        Position pos = zombie.nextPos_;
+        if (pos.x_ < 0 || pos.x_ >= Helpers::mapWidth || pos.y_ < 0
+            || pos.y_ >= Helpers::mapHeight)
+            cellsLinked = false;
+        parent_[points_.size()] = points_.size();
+        points_.push_back(pos);
+        ids_.push_back(zombie.id_);
+        cells_.push_back(cellOf(pos));
+        maxId = max(maxId, zombie.id_);
+    }
+
+    int cellCount = columns_*rows_;
+    cellStart_.assign(cellCount + 1, 0);
+    for (int i = 0; i < n; i++)
+    {
+        cellStart_[cells_[i] + 1]++;
+    }
+    for (int c = 0; c < cellCount; c++)
+    {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+    cellItems_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        cellItems_[--cellStart_[cells_[i] + 1]] = i;
+    }
+    // Filling backwards leaves cellStart_[c + 1] at the start of cell c.
+    for (int c = 0; c < cellCount; c++)
+    {
+        cellStart_[c] = cellStart_[c + 1];
+    }
+    cellStart_[cellCount] = n;
+
+    for (int cell = 0; cell < cellCount; cell++)
+    {
+        int begin = cellStart_[cell];
+        int end = cellStart_[cell + 1];
+        if (begin == end)
+            continue;
+        if (cellsLinked)
+        {
+            for (int k = begin + 1; k < end; k++)
+            {
+                unite(cellItems_[begin], cellItems_[k]);
+            }
+        }
+        else
+        {
+            linkCells(cell, cell, false);
+        }
+        int column = cell % columns_;
+        int row = cell / columns_;
+        for (int r = row; r <= min(row + reach_, rows_ - 1); r++)
+        {
+            int first = r == row ? column + 1 : max(column - reach_, 0);
+            for (int c = first; c <= min(column + reach_, columns_ - 1); c++)
+            {
+                linkCells(cell, r*columns_ + c, cellsLinked);
+            }
+        }
+    }
+
+    clusterByIndex_.assign(n, -1);
+    clusterById_.assign(maxId + 1, -1);
+    sizes_.clear();
+    sumX_.clear();
+    sumY_.clear();
+    int i = 0;
+    for (auto const &zombie: zombies)
+    {
+        int root = find(i);
+        if (clusterByIndex_[root] < 0)
+        {
+            clusterByIndex_[root] = sizes_.size();
+            sizes_.push_back(0);
+            sumX_.push_back(0);
+            sumY_.push_back(0);
+        }
+        int cluster = clusterByIndex_[root];
+        clusterById_[zombie.id_] = cluster;
+        sizes_[cluster]++;
+        sumX_[cluster] += points_[i].x_;
+        sumY_[cluster] += points_[i].y_;
+        i++;
+    }
+}
+
+void ZombieClusters::clear()
+{
+    points_.clear();
+    ids_.clear();
+    clusterById_.clear();
+    sizes_.clear();
+    sumX_.clear();
+    sumY_.clear();
+}
+
+int ZombieClusters::clusterOf(int zombieId)
+{
+    if (zombieId < 0 || zombieId >= int(clusterById_.size()))
+        return -1;
+    return clusterById_[zombieId];
+}
+
+int ZombieClusters::getCount()
+{
+    return sizes_.size();
+}
+
+int ZombieClusters::size(int cluster)
+{
+    return sizes_[cluster];
+}
+
+Position ZombieClusters::centroid(int cluster)
+{
+    return Position(sumX_[cluster]/sizes_[cluster],
+        sumY_[cluster]/sizes_[cluster]);
+}
+
+int ZombieClusters::largest()
+{
+    int best = -1;
+    for (int c = 0; c < int(sizes_.size()); c++)
+    {
+        if (best < 0 || sizes_[c] > sizes_[best])
+            best = c;
+    }
+    return best;
+}
+
+Position ZombieClusters::neighbourhoodCentroid(Position center)
+{
+    collectNeighbours(center);
+    if (neighbours_.empty())
+        return Position(0, 0);
+    long long sumX = 0;
+    long long sumY = 0;
+    for (auto index: neighbours_)
+    {
+        sumX += points_[index].x_;
+        sumY += points_[index].y_;
+    }
+    int count = neighbours_.size();
+    return Position(sumX/count, sumY/count);
+}
+
+void ZombieClusters::neighbourhood(Position center, vector<int> &zombieIds)
+{
+    collectNeighbours(center);
+    zombieIds.clear();
+    for (auto index: neighbours_)
+    {
+        zombieIds.push_back(ids_[index]);
+    }
+}
+
+// Scans the (2*reach_ + 1)^2 cells around center: reach_ is 2 for the
+// default radius, as the cells are only radius/sqrt(2) wide.
+void ZombieClusters::collectNeighbours(Position center)
+{
+    neighbours_.clear();
+    int home = cellOf(center);
+    int column = home % columns_;
+    int row = home / columns_;
+    for (int r = max(row - reach_, 0); r <= min(row + reach_, rows_ - 1); r++)
+    {
+        for (int c = max(column - reach_, 0);
+            c <= min(column + reach_, columns_ - 1); c++)
+        {
+            int cell = r*columns_ + c;
+            for (int k = cellStart_[cell]; k < cellStart_[cell + 1]; k++)
+            {
+                if (Helpers::distance(center, points_[cellItems_[k]])
+                    < radius_)
+                    neighbours_.push_back(cellItems_[k]);
+            }
+        }
+    }
+}
+
+void ZombieClusters::linkCells(int a, int b, bool cellsLinked)
+{
+    int beginA = cellStart_[a], endA = cellStart_[a + 1];
+    int beginB = cellStart_[b], endB = cellStart_[b + 1];
+    if (beginB == endB)
+        return;
+    if (cellsLinked && find(cellItems_[beginA]) == find(cellItems_[beginB]))
+        return;
+    double radiusSqr = radius_*radius_;
+    for (int i = beginA; i < endA; i++)
+    {
+        Position p = points_[cellItems_[i]];
+        for (int j = a == b ? i + 1 : beginB; j < endB; j++)
+        {
+            Position q = points_[cellItems_[j]];
+            double dx = q.x_ - p.x_;
+            double dy = q.y_ - p.y_;
+            if (dx*dx + dy*dy < radiusSqr)
+            {
+                unite(cellItems_[i], cellItems_[j]);
+                // Both cells are already connected inside, one link joins
+                // them.
+                if (cellsLinked)
+                    return;
+            }
+        }
+    }
+}
+
+int ZombieClusters::cellOf(Position pos)
+{
+    int column = min(max(int(pos.x_/cellSize_), 0), columns_ - 1);
+    int row = min(max(int(pos.y_/cellSize_), 0), rows_ - 1);
+    return row*columns_ + column;
+}
+
+int ZombieClusters::find(int index)
+{
+    while (parent_[index] != index)
+    {
+        parent_[index] = parent_[parent_[index]];
+        index = parent_[index];
+    }
+    return index;
+}
+
+void ZombieClusters::unite(int a, int b)
+{
+    a = find(a);
+    b = find(b);
+    if (a == b)
+        return;
+    if (a < b)
+        parent_[b] = a;
+    else
+        parent_[a] = b;
+}
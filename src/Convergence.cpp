@@ -0,0 +1,108 @@
+#include "Convergence.hpp"
+
+using namespace std;
+
+const int ConvergenceForecaster::noDeadline;
+
+bool ConvergenceForecaster::Pursuer::operator<(Pursuer const &rhs) const
+{
+    if (targetId_ != rhs.targetId_)
+        return targetId_ < rhs.targetId_;
+    return dist_ < rhs.dist_;
+}
+
+void ConvergenceForecaster::update(GameData const &data,
+    TrajectoryCache &trajectories)
+{
+    pursuers_.clear();
+    for (auto const &zombie: data.zombies_)
+    {
+        Pursuer pursuer;
+        pursuer.targetId_ = trajectories.getTargetId(zombie.id_);
+        pursuer.target_ = trajectories.getTarget(zombie.id_);
+        pursuer.dist_ = Helpers::distance(zombie.pos_, pursuer.target_);
+        pursuers_.push_back(pursuer);
+    }
+    sort(pursuers_.begin(), pursuers_.end());
+
+    targets_.clear();
+    steps_.clear();
+    int n = pursuers_.size();
+    for (int i = 0; i < n;)
+    {
+        Pursuer const &nearest = pursuers_[i];
+        ConvergenceTarget target;
+        target.targetId_ = nearest.targetId_;
+        target.pos_ = nearest.target_;
+        target.deadline_ = nearest.targetId_ == TrajectoryCache::ashTarget
+            ? noDeadline : ceil(nearest.dist_/Helpers::zombieStepSize);
+        target.ashTurns_ = ceil(Helpers::distance(data.ashPos_, target.pos_)
+            /Helpers::ashStepSize);
+        target.first_ = steps_.size();
+        target.steps_ = 0;
+        int kills = 0;
+        for (; i < n && pursuers_[i].targetId_ == target.targetId_; i++)
+        {
+            double outside = pursuers_[i].dist_ - Helpers::shootingRadius;
+            int turn = outside <= 0 ? 0 : ceil(outside/Helpers::zombieStepSize);
+            kills++;
+            if (turn > target.deadline_)
+                continue;
+            if (target.steps_ > 0 && steps_.back().turn_ == turn)
+            {
+                steps_.back().kills_ = kills;
+                continue;
+            }
+            ComboStep step = {kills, turn};
+            steps_.push_back(step);
+            target.steps_++;
+        }
+        targets_.push_back(target);
+    }
+}
+
+int ConvergenceForecaster::getTargetCount()
+{
+    return targets_.size();
+}
+
+ConvergenceTarget const &ConvergenceForecaster::getTarget(int index)
+{
+    return targets_[index];
+}
+
+ComboStep const &ConvergenceForecaster::getStep(int index, int step)
+{
+    return steps_[targets_[index].first_ + step];
+}
+
+int ConvergenceForecaster::findTarget(int targetId)
+{
+    int low = 0;
+    int high = targets_.size();
+    while (low < high)
+    {
+        int mid = (low + high)/2;
+        if (targets_[mid].targetId_ < targetId)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low < int(targets_.size()) && targets_[low].targetId_ == targetId)
+        return low;
+    return -1;
+}
+
+int ConvergenceForecaster::bestKills(int index, int byTurn)
+{
+    ConvergenceTarget const &target = targets_[index];
+    int kills = 0;
+    for (int step = 0; step < target.steps_; step++)
+    {
+        ComboStep const &combo = steps_[target.first_ + step];
+        if (combo.turn_ > byTurn)
+            break;
+        kills = combo.kills_;
+    }
+    return kills;
+}
@@ -0,0 +1,144 @@
+#include "DebugLog.hpp"
+
+#include <cstdio>
+
+using namespace std;
+
+DebugLogParser::DebugLogParser(istream &input):
+    input_(input), expect_(ashPos), remaining_(0),
+    lineCount_(0), skippedLines_(0), droppedTurns_(0)
+{}
+
+bool DebugLogParser::next(GameData &data)
+{
+    while (getline(input_, line_))
+    {
+        lineCount_++;
+        if (parseLine(data))
+        {
+            return true;
+        }
+    }
+    if (expect_ != ashPos)
+    {
+        restart();
+    }
+    return false;
+}
+
+long DebugLogParser::getLineCount()
+{
+    return lineCount_;
+}
+
+long DebugLogParser::getSkippedLines()
+{
+    return skippedLines_;
+}
+
+long DebugLogParser::getDroppedTurns()
+{
+    return droppedTurns_;
+}
+
+bool DebugLogParser::isNewGame(GameData const &prev, GameData const &curr)
+{
+    double ashMove = Helpers::distance(prev.ashPos_, curr.ashPos_);
+    if (ashMove > Helpers::ashStepSize + 1)
+        return true;
+    for (auto human: curr.humans_)
+    {
+        if (prev.humans_.find(human) == prev.humans_.end())
+            return true;
+    }
+    for (auto zombie: curr.zombies_)
+    {
+        if (prev.zombies_.find(zombie) == prev.zombies_.end())
+            return true;
+    }
+    return false;
+}
+
+bool DebugLogParser::parseLine(GameData &data)
+{
+    const char* line = line_.c_str();
+    int x, y, id, count, cat, nextX, nextY;
+    double appeal;
+    if (sscanf(line, "AshPos: %d %d", &x, &y) == 2)
+    {
+        if (expect_ != ashPos)
+        {
+            droppedTurns_++;
+        }
+        data.ashPos_ = Position(x, y);
+        data.humans_.clear();
+        data.zombies_.clear();
+        expect_ = humanCount;
+        return false;
+    }
+    switch (expect_)
+    {
+        case ashPos:
+        {
+            skippedLines_++;
+            return false;
+        }
+        case humanCount:
+        {
+            if (sscanf(line, "HumanCount: %d", &count) != 1)
+                break;
+            data.humanCount_ = count;
+            remaining_ = count;
+            expect_ = count > 0 ? human : zombieCount;
+            return false;
+        }
+        case human:
+        {
+            if (sscanf(line, "[%d] %d %d, cat: %d", &id, &x, &y, &cat) != 4)
+                break;
+            Human hum(id, Position(x, y));
+            hum.cat_ = Human::Category(cat);
+            data.humans_.insert(data.humans_.end(), hum);
+            if (--remaining_ == 0)
+                expect_ = zombieCount;
+            return false;
+        }
+        case zombieCount:
+        {
+            if (sscanf(line, "ZombieCount: %d", &count) != 1)
+                break;
+            data.zombieCount_ = count;
+            remaining_ = count;
+            expect_ = count > 0 ? zombie : ashPos;
+            return count == 0;
+        }
+        case zombie:
+        {
+            if (sscanf(line, "[%d] %d %d, %d %d, appeal: %lf",
+                &id, &x, &y, &nextX, &nextY, &appeal) != 6)
+                break;
+            Zombie zom(id, Position(x, y), Position(nextX, nextY));
+            zom.appealFactor_ = appeal;
+            data.zombies_.insert(data.zombies_.end(), zom);
+            if (--remaining_ == 0)
+            {
+                expect_ = ashPos;
+                return true;
+            }
+            return false;
+        }
+    }
+    skippedLines_++;
+    if (line[0] == '[' || line_.find("Count: ") != string::npos)
+    {
+        restart();
+    }
+    return false;
+}
+
+void DebugLogParser::restart()
+{
+    droppedTurns_++;
+    expect_ = ashPos;
+    remaining_ = 0;
+}
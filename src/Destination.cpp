@@ -0,0 +1,172 @@
+#include "Destination.hpp"
+
+using namespace std;
+
+namespace
+{
+long long squaredDistance(Position p1, Position p2)
+{
+    long long x = p2.x_ - p1.x_;
+    long long y = p2.y_ - p1.y_;
+    return x*x + y*y;
+}
+}
+
+const int DestinationSearch::coarseStep;
+const int DestinationSearch::frontierSize;
+const int DestinationSearch::nearMissBand;
+const int DestinationSearch::heatmapSlack;
+
+bool DestinationSearch::Candidate::operator<(Candidate const &rhs) const
+{
+    if (kills_ != rhs.kills_)
+        return kills_ > rhs.kills_;
+    if (pressure_ != rhs.pressure_)
+        return pressure_ > rhs.pressure_;
+    return offset_ < rhs.offset_;
+}
+
+DestinationSearch::DestinationSearch():
+    zombies_(&arena_), lattice_(&arena_), candidates_(&arena_),
+    frontier_(&arena_), evaluations_(0), budget_(0)
+{}
+
+DestinationSearch::DestinationSearch(DestinationSearch const &):
+    DestinationSearch()
+{}
+
+DestinationSearch &DestinationSearch::operator=(DestinationSearch const &)
+{
+    candidates_.clear();
+    evaluations_ = 0;
+    return *this;
+}
+
+Position DestinationSearch::search(Position ash, Position preferred,
+    FlatSet<Zombie> const &zombies, int maxEvaluations,
+    KillHeatmap* heatmap)
+{
+    preferred_ = preferred;
+    evaluations_ = 0;
+    budget_ = maxEvaluations;
+    arena_.reset();
+    renew(zombies_);
+    renew(lattice_);
+    renew(candidates_);
+    renew(frontier_);
+    zombies_.reserve(zombies.size());
+    for (auto const &zombie: zombies)
+    {
+        zombies_.push_back(zombie.nextPos_);
+    }
+
+    evaluate(preferred);
+    int reach = Helpers::ashStepSize;
+    for (int dy = -reach; dy <= reach; dy += coarseStep)
+    {
+        for (int dx = -reach; dx <= reach; dx += coarseStep)
+        {
+            if (dx*dx + dy*dy <= reach*reach)
+                lattice_.push_back(Position(ash.x_ + dx, ash.y_ + dy));
+        }
+    }
+    sort(lattice_.begin(), lattice_.end(), [&preferred](Position a, Position b)
+    {
+        return squaredDistance(a, preferred) < squaredDistance(b, preferred);
+    });
+    if (heatmap)
+    {
+        int best = 0;
+        for (auto const &pos: lattice_)
+        {
+            best = max(best, heatmap->countAt(1, pos));
+        }
+        lattice_.erase(remove_if(lattice_.begin(), lattice_.end(),
+            [heatmap, best](Position pos)
+            {
+                return heatmap->countAt(1, pos) < best - heatmapSlack;
+            }), lattice_.end());
+    }
+    bool running = true;
+    for (unsigned i = 0; i < lattice_.size() && running; i++)
+    {
+        if (!seen(lattice_[i]))
+            running = evaluate(lattice_[i]);
+    }
+
+    for (int step = coarseStep/2; step >= 1 && running; step /= 2)
+    {
+        frontier_.resize(min<int>(frontierSize, candidates_.size()));
+        partial_sort_copy(candidates_.begin(), candidates_.end(),
+            frontier_.begin(), frontier_.end());
+        for (unsigned f = 0; f < frontier_.size() && running; f++)
+        {
+            Position centre = frontier_[f].pos_;
+            for (int dy = -step; dy <= step && running; dy += step)
+            {
+                for (int dx = -step; dx <= step && running; dx += step)
+                {
+                    Position pos(centre.x_ + dx, centre.y_ + dy);
+                    if (squaredDistance(ash, pos) > (long long)reach*reach
+                        || seen(pos))
+                        continue;
+                    running = evaluate(pos);
+                }
+            }
+        }
+    }
+
+    if (candidates_.empty())
+        return preferred;
+    return min_element(candidates_.begin(), candidates_.end())->pos_;
+}
+
+int DestinationSearch::getBestKills()
+{
+    if (candidates_.empty())
+        return 0;
+    return min_element(candidates_.begin(), candidates_.end())->kills_;
+}
+
+int DestinationSearch::getEvaluations()
+{
+    return evaluations_;
+}
+
+bool DestinationSearch::evaluate(Position pos)
+{
+    if (evaluations_ >= budget_)
+        return false;
+    if (pos.x_ < 0 || pos.x_ >= Helpers::mapWidth || pos.y_ < 0
+        || pos.y_ >= Helpers::mapHeight)
+        return true;
+    PROFILE_COUNT(zombiesScanned, zombies_.size());
+    evaluations_++;
+    long long range = Helpers::shootingRadius;
+    long long band = range + nearMissBand;
+    Candidate candidate;
+    candidate.pos_ = pos;
+    candidate.kills_ = 0;
+    candidate.pressure_ = 0;
+    candidate.offset_ = Helpers::distance(pos, preferred_);
+    for (auto zombie: zombies_)
+    {
+        long long dist = squaredDistance(pos, zombie);
+        if (dist <= range*range)
+            candidate.kills_++;
+        else if (dist <= band*band)
+            candidate.pressure_ += band - sqrt(double(dist));
+    }
+    candidates_.push_back(candidate);
+    return true;
+}
+
+bool DestinationSearch::seen(Position pos)
+{
+    for (auto const &candidate: candidates_)
+    {
+        if (candidate.pos_.x_ == pos.x_ && candidate.pos_.y_ == pos.y_)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,163 @@
+#include "Divergence.hpp"
+
+using namespace std;
+
+DivergenceMonitor::DivergenceMonitor(ostream* log):
+    log_(log), hasPrediction_(false), turn_(0), checkedTurns_(0),
+    divergentTurns_(0), ashMismatches_(0), zombieMismatches_(0),
+    killMismatches_(0), humanMismatches_(0), turnMismatches_(0)
+{}
+
+void DivergenceMonitor::onTurn(GameData const &data, Position solution)
+{
+    check(data);
+    predict(data, solution);
+}
+
+void DivergenceMonitor::predict(GameData const &data, Position solution)
+{
+    sim_.load(data);
+    sim_.step(solution);
+    sim_.getData(predicted_);
+    hasPrediction_ = true;
+}
+
+bool DivergenceMonitor::check(GameData const &actual)
+{
+    turn_++;
+    if (!hasPrediction_)
+        return true;
+    hasPrediction_ = false;
+    checkedTurns_++;
+    turnMismatches_ = 0;
+
+    if (predicted_.ashPos_.x_ != actual.ashPos_.x_
+        || predicted_.ashPos_.y_ != actual.ashPos_.y_)
+    {
+        mismatch(ashMismatches_, "ash", 0, "position",
+            predicted_.ashPos_, actual.ashPos_);
+    }
+    for (auto zombie: predicted_.zombies_)
+    {
+        auto it = actual.zombies_.find(zombie);
+        if (it == actual.zombies_.end())
+        {
+            mismatch(killMismatches_, "zombie", zombie.id_,
+                "killed, predicted alive");
+        }
+        else if (zombie.pos_.x_ != it->pos_.x_
+            || zombie.pos_.y_ != it->pos_.y_)
+        {
+            mismatch(zombieMismatches_, "zombie", zombie.id_,
+                "position", zombie.pos_, it->pos_);
+        }
+        else if (zombie.nextPos_.x_ != it->nextPos_.x_
+            || zombie.nextPos_.y_ != it->nextPos_.y_)
+        {
+            mismatch(zombieMismatches_, "zombie", zombie.id_,
+                "next position", zombie.nextPos_, it->nextPos_);
+        }
+    }
+    for (auto zombie: actual.zombies_)
+    {
+        if (predicted_.zombies_.count(zombie) == 0)
+            mismatch(killMismatches_, "zombie", zombie.id_,
+                "alive, predicted killed");
+    }
+    for (auto human: predicted_.humans_)
+    {
+        if (actual.humans_.count(human) == 0)
+            mismatch(humanMismatches_, "human", human.id_,
+                "eaten, predicted alive");
+    }
+    for (auto human: actual.humans_)
+    {
+        if (predicted_.humans_.count(human) == 0)
+            mismatch(humanMismatches_, "human", human.id_,
+                "alive, predicted eaten");
+    }
+
+    if (turnMismatches_ == 0)
+        return true;
+    divergentTurns_++;
+    if (log_)
+    {
+        *log_ << "Divergence on turn " << turn_ << ": " << turnMismatches_
+            << " mismatches, first " << firstMismatch_.entity_ << " "
+            << firstMismatch_.id_ << " " << firstMismatch_.what_;
+        if (firstMismatch_.positions_)
+        {
+            *log_ << " predicted " << firstMismatch_.predicted_.x_ << " "
+                << firstMismatch_.predicted_.y_ << " got "
+                << firstMismatch_.actual_.x_ << " "
+                << firstMismatch_.actual_.y_;
+        }
+        *log_ << endl;
+    }
+    return false;
+}
+
+GameData const &DivergenceMonitor::getPrediction()
+{
+    return predicted_;
+}
+
+void DivergenceMonitor::report(ostream &out)
+{
+    out << "Divergence: " << divergentTurns_ << " of " << checkedTurns_
+        << " turns, ash " << ashMismatches_
+        << ", zombie moves " << zombieMismatches_
+        << ", kills " << killMismatches_
+        << ", humans " << humanMismatches_ << endl;
+}
+
+int DivergenceMonitor::getCheckedTurns()
+{
+    return checkedTurns_;
+}
+
+int DivergenceMonitor::getDivergentTurns()
+{
+    return divergentTurns_;
+}
+
+int DivergenceMonitor::getAshMismatches()
+{
+    return ashMismatches_;
+}
+
+int DivergenceMonitor::getZombieMismatches()
+{
+    return zombieMismatches_;
+}
+
+int DivergenceMonitor::getKillMismatches()
+{
+    return killMismatches_;
+}
+
+int DivergenceMonitor::getHumanMismatches()
+{
+    return humanMismatches_;
+}
+
+void DivergenceMonitor::mismatch(int &counter, const char* entity, int id,
+    const char* what)
+{
+    Mismatch entry = {entity, id, what, false, Position(), Position()};
+    mismatch(counter, entry);
+}
+
+void DivergenceMonitor::mismatch(int &counter, const char* entity, int id,
+    const char* what, Position predicted, Position actual)
+{
+    Mismatch entry = {entity, id, what, true, predicted, actual};
+    mismatch(counter, entry);
+}
+
+void DivergenceMonitor::mismatch(int &counter, Mismatch const &entry)
+{
+    counter++;
+    if (turnMismatches_++ == 0)
+        firstMismatch_ = entry;
+}
@@ -0,0 +1,163 @@
+#include "Enclosing.hpp"
+
+using namespace std;
+
+namespace
+{
+// Points found on the boundary of a circle built from them must still
+// count as inside despite rounding.
+const double boundaryTolerance = 1e-6;
+}
+
+EnclosingCircle::EnclosingCircle(unsigned seed): rng_(seed)
+{
+    circle_.x_ = 0;
+    circle_.y_ = 0;
+    circle_.radius_ = 0;
+    points_.reserve(Helpers::maxZombies);
+}
+
+Circle const &EnclosingCircle::solve(vector<Position> const &points)
+{
+    points_.assign(points.begin(), points.end());
+    enclose(HUGE_VAL);
+    return circle_;
+}
+
+bool EnclosingCircle::fits(vector<Position> const &points, double limit)
+{
+    points_.assign(points.begin(), points.end());
+    return enclose(limit);
+}
+
+int EnclosingCircle::firstSingleShot(TrajectoryCache &cache,
+    vector<int> const &zombieIds, int maxTurn)
+{
+    double limit = Helpers::shootingRadius - 1;
+    // Flooring can lengthen a step by up to sqrt(2).
+    double maxMove = Helpers::zombieStepSize + 2;
+    int turn = 0;
+    while (turn <= maxTurn)
+    {
+        points_.clear();
+        for (auto id: zombieIds)
+        {
+            points_.push_back(cache.positionAt(id, turn));
+        }
+        if (enclose(limit))
+            return turn;
+        int skip = ceil((circle_.radius_ - limit)/maxMove);
+        turn += max(skip, 1);
+    }
+    return -1;
+}
+
+Circle const &EnclosingCircle::getCircle()
+{
+    return circle_;
+}
+
+Position EnclosingCircle::shotPoint()
+{
+    return Position(round(circle_.x_), round(circle_.y_));
+}
+
+bool EnclosingCircle::enclose(double limit)
+{
+    int n = points_.size();
+    circle_.radius_ = 0;
+    if (n == 0)
+        return true;
+
+    // Half the longer side of the bounding box is a lower bound on the
+    // radius, which rejects groups that are spread out without a shuffle.
+    int minX = points_[0].x_, maxX = minX;
+    int minY = points_[0].y_, maxY = minY;
+    for (auto point: points_)
+    {
+        minX = min(minX, point.x_);
+        maxX = max(maxX, point.x_);
+        minY = min(minY, point.y_);
+        maxY = max(maxY, point.y_);
+    }
+    circle_.x_ = (minX + maxX)/2.0;
+    circle_.y_ = (minY + maxY)/2.0;
+    double halfWidth = (maxX - minX)/2.0;
+    double halfHeight = (maxY - minY)/2.0;
+    circle_.radius_ = max(halfWidth, halfHeight);
+    if (circle_.radius_ > limit)
+        return false;
+
+    shuffle(points_.begin(), points_.end(), rng_);
+    circle_.x_ = points_[0].x_;
+    circle_.y_ = points_[0].y_;
+    circle_.radius_ = 0;
+    for (int i = 1; i < n; i++)
+    {
+        if (contains(circle_, points_[i]))
+            continue;
+        circle_.x_ = points_[i].x_;
+        circle_.y_ = points_[i].y_;
+        circle_.radius_ = 0;
+        for (int j = 0; j < i; j++)
+        {
+            if (contains(circle_, points_[j]))
+                continue;
+            circle_ = fromTwo(points_[i], points_[j]);
+            for (int k = 0; k < j; k++)
+            {
+                if (!contains(circle_, points_[k]))
+                    circle_ = fromThree(points_[i], points_[j], points_[k]);
+            }
+        }
+        if (circle_.radius_ > limit)
+            return false;
+    }
+    return true;
+}
+
+bool EnclosingCircle::contains(Circle const &circle, Position point)
+{
+    double dx = point.x_ - circle.x_;
+    double dy = point.y_ - circle.y_;
+    return sqrt(dx*dx + dy*dy) <= circle.radius_ + boundaryTolerance;
+}
+
+Circle EnclosingCircle::fromTwo(Position a, Position b)
+{
+    Circle circle;
+    circle.x_ = (a.x_ + b.x_)/2.0;
+    circle.y_ = (a.y_ + b.y_)/2.0;
+    circle.radius_ = Helpers::distance(a, b)/2;
+    return circle;
+}
+
+Circle EnclosingCircle::fromThree(Position a, Position b, Position c)
+{
+    double bx = b.x_ - a.x_;
+    double by = b.y_ - a.y_;
+    double cx = c.x_ - a.x_;
+    double cy = c.y_ - a.y_;
+    double det = 2*(bx*cy - by*cx);
+    if (det == 0)
+    {
+        // Collinear: the two points furthest apart span the circle.
+        Circle circle = fromTwo(a, b);
+        Circle other = fromTwo(a, c);
+        if (other.radius_ > circle.radius_)
+            circle = other;
+        other = fromTwo(b, c);
+        if (other.radius_ > circle.radius_)
+            circle = other;
+        return circle;
+    }
+    double lengthB = bx*bx + by*by;
+    double lengthC = cx*cx + cy*cy;
+    double ux = (cy*lengthB - by*lengthC)/det;
+    double uy = (bx*lengthC - cx*lengthB)/det;
+    Circle circle;
+    circle.x_ = a.x_ + ux;
+    circle.y_ = a.y_ + uy;
+    circle.radius_ = sqrt(ux*ux + uy*uy);
+    return circle;
+}
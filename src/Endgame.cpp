@@ -0,0 +1,153 @@
+#include "Endgame.hpp"
+
+using namespace std;
+
+namespace
+{
+int bitCount(int mask)
+{
+    int count = 0;
+    for (; mask; mask &= mask - 1)
+    {
+        count++;
+    }
+    return count;
+}
+}
+
+const int EndgameSolver::maxZombies;
+const int EndgameSolver::maxLegTurns;
+
+EndgameSolver::EndgameSolver():
+    bestScore_(-1), bestTurns_(0), nodes_(0), pruned_(0)
+{
+    for (auto &state: states_)
+    {
+        state.reserve(Rules::maxHumans, maxZombies);
+    }
+}
+
+bool EndgameSolver::advise(GameData const &data, Position &move)
+{
+    if (data.zombies_.empty() || int(data.zombies_.size()) > maxZombies)
+        return false;
+    if (solve(data) <= 0)
+        return false;
+    move = firstMove_;
+    return true;
+}
+
+int EndgameSolver::solve(GameData const &data)
+{
+    TRACE_SCOPE("endgame", "planner");
+    bestScore_ = -1;
+    bestTurns_ = 0;
+    nodes_ = 0;
+    pruned_ = 0;
+    firstMove_ = data.ashPos_;
+    if (int(data.zombies_.size()) > maxZombies)
+        return bestScore_;
+    states_[0].load(data);
+    search(0, data.ashPos_);
+    Trace::counter("endgameNodes", nodes_);
+    return bestScore_;
+}
+
+Position EndgameSolver::getFirstMove()
+{
+    return firstMove_;
+}
+
+int EndgameSolver::getBestScore()
+{
+    return bestScore_;
+}
+
+int EndgameSolver::getBestTurns()
+{
+    return bestTurns_;
+}
+
+int EndgameSolver::getNodes()
+{
+    return nodes_;
+}
+
+int EndgameSolver::getPruned()
+{
+    return pruned_;
+}
+
+void EndgameSolver::search(int depth, Position firstMove)
+{
+    Simulator &state = states_[depth];
+    if (state.isOver())
+    {
+        int score = state.getScore();
+        if (score > bestScore_
+            || (score == bestScore_ && state.getTurn() < bestTurns_))
+        {
+            bestScore_ = score;
+            bestTurns_ = state.getTurn();
+            firstMove_ = firstMove;
+        }
+        return;
+    }
+    int zombies = state.getZombiesAlive();
+    state.getData(boundData_);
+    if (Bounds::tight(boundData_, state.getScore()) < bestScore_)
+    {
+        pruned_++;
+        return;
+    }
+    int masks = 1 << zombies;
+    for (int size = zombies; size >= 0; size--)
+    {
+        for (int mask = 0; mask < masks; mask++)
+        {
+            if (bitCount(mask) != size)
+                continue;
+            Simulator &next = states_[depth + 1];
+            next = state;
+            Position legMove;
+            nodes_++;
+            if (!playLeg(next, mask, legMove))
+                continue;
+            search(depth + 1, depth == 0 ? legMove : firstMove);
+        }
+    }
+}
+
+bool EndgameSolver::playLeg(Simulator &sim, int mask, Position &firstMove)
+{
+    int zombies = sim.getZombiesAlive();
+    for (int turn = 0; turn < maxLegTurns; turn++)
+    {
+        Position target = legTarget(sim, mask);
+        if (turn == 0)
+            firstMove = target;
+        sim.step(target);
+        if (sim.isOver() || sim.getZombiesAlive() < zombies)
+            return true;
+    }
+    return false;
+}
+
+Position EndgameSolver::legTarget(Simulator &sim, int mask)
+{
+    if (mask == 0)
+        return sim.getAshPos();
+    int x = 0;
+    int y = 0;
+    int count = 0;
+    for (int index = 0; index < sim.getZombiesAlive(); index++)
+    {
+        if (!(mask & (1 << index)))
+            continue;
+        Position next = sim.getZombie(index).nextPos_;
+        x += next.x_;
+        y += next.y_;
+        count++;
+    }
+    return Position(x/count, y/count);
+}
@@ -38,8 +38,18 @@ bool Zombie::operator<(const Zombie& rhs) const
     return id_ < rhs.id_;
 }
 
+StrategyParams::StrategyParams():
+    zombieFactor_(Helpers::zombieFactor),
+    humanFactor_(Helpers::humanFactor),
+    endangeredFactor_(Helpers::endangeredFactor),
+    ashFactor_(Helpers::ashFactor),
+    neighbourhoodRadius_(Helpers::neighbourhoodRadius),
+    endangeredSteps_(Helpers::endangeredSteps)
+{}
+
 double Helpers::distance(Position p1, Position p2)
 {
+    PROFILE_COUNT(distanceEvaluations, 1);
     double x = p2.x_ - p1.x_;
     double y = p2.y_ - p1.y_;
     return sqrt(x*x + y*y);
@@ -74,11 +84,44 @@ int Helpers::steps(Human human, Position pos)
 
 int Helpers::steps(Position pos, Zombie zombie)
 {
-    double dist = Helpers::distance(
-        pos, zombie);
-    dist = dist - Helpers::shootingRadius;
-    dist = dist/Helpers::ashStepSize;
-    return ceil(dist);
+    return Intercept::solve(pos, zombie).turns_;
+}
+
+namespace
+{
+// Largest c with c*sqrt(distSqr) <= bound, compared exactly in integers.
+bool notAbove(long long c, long long distSqr, long long bound)
+{
+    if (bound >= 0)
+        return c <= 0 || c*c*distSqr <= bound*bound;
+    return c < 0 && c*c*distSqr >= bound*bound;
+}
+
+int floorStep(int delta, long long distSqr, int stepSize)
+{
+    long long bound = (long long)stepSize*delta;
+    long long c = floor(bound/sqrt(double(distSqr)));
+    while (!notAbove(c, distSqr, bound))
+        c--;
+    while (notAbove(c + 1, distSqr, bound))
+        c++;
+    return c;
+}
+}
+
+// Referee movement: land on the target when it is within one step,
+// otherwise floor(from + stepSize*delta/dist) per coordinate. The double
+// estimate is checked and corrected in integers, so rounding never moves
+// a unit across the shooting radius.
+Position Helpers::move(Position from, Position to, int stepSize)
+{
+    int dx = to.x_ - from.x_;
+    int dy = to.y_ - from.y_;
+    long long distSqr = (long long)dx*dx + (long long)dy*dy;
+    if (distSqr <= (long long)stepSize*stepSize)
+        return to;
+    return Position(from.x_ + floorStep(dx, distSqr, stepSize),
+        from.y_ + floorStep(dy, distSqr, stepSize));
 }
 
 Position VectorOpers::subtract(Position p2, Position p1)
@@ -111,9 +154,21 @@ Position VectorOpers::rotate(Position pos, double angle)
     return Position(x,y);
 }
 
-GameController::GameController()
+const int GameController::destinationEvaluations;
+const int GameController::cleanupEvaluations;
+const int GameController::cleanupMaxCluster;
+const int GameController::singleShotHorizon;
+
+GameController::GameController():
+    heatmap_(1)
 {
     state_ = normalMode;
+    verbose_ = DEBUG_PRINT;
+    listener_ = 0;
+    advisor_ = 0;
+    ponderer_ = 0;
+    rescueTargets_.reserve(Helpers::maxHumans);
+    groupIds_.reserve(Helpers::maxZombies);
 }
 
 GameController::~GameController()
@@ -121,40 +176,41 @@ GameController::~GameController()
 
 void GameController::startGame()
 {
-    Position solution;
-    while (1)
+    while (runTurn(std::cin))
+    {}
+    if (verbose_)
     {
-        loadGameData(std::cin);
-        chooseStrategy();
-        switch (state_)
-        {
-            case normalMode:
-            {
-                solution = attackMostDenseZombie();
-                break;
-            }
-            case rescueEndangered:
-            {
-                solution = goToClosestEndangered();
-                break;
-            }
-            case rescueHuman:
-            {
-                solution = rescueMissionStrategy();
-                break;
-            }
-        }
-        if (DEBUG_PRINT)
-        {
-            debugPrint(data_);
-            cerr << "State: " << state_ << endl;
-        }
-        writeSolution(solution);
+        Profiler::report(cerr);
     }
 }
 
+bool GameController::runTurn(std::istream& input)
+{
+    input >> std::ws;
+    if (input.eof())
+        return false;
+    TRACE_SCOPE("turn", "game");
+    loadGameData(input);
+    if (ponderer_)
+        ponderer_->collect(data_);
+    Trace::counter("zombies", data_.zombieCount_);
+    Position solution = playTurn();
+    if (verbose_)
+    {
+        debugPrint(data_);
+        cerr << "State: " << state_ << endl;
+    }
+    if (listener_)
+        listener_->onTurn(data_, solution);
+    writeSolution(solution);
+    if (ponderer_)
+        ponderer_->ponder(data_, solution);
+    return true;
+}
+
 void GameController::loadGameData(std::istream& input)
 {
+    PROFILE_PHASE(loadGameData);
     data_.humans_.clear();
     data_.zombies_.clear();
     int x,y;
@@ -179,15 +235,69 @@ void GameController::loadGameData(std::istream& input)
             Position(zombieXNext, zombieYNext));
         data_.zombies_.insert(zom);
     }
+    clusters_.build(data_.zombies_, params_.neighbourhoodRadius_);
+}
+
+void GameController::loadGameData(GameData const &data)
+{
+    PROFILE_PHASE(loadGameData);
+    data_ = data;
+    for (auto &human: data_.humans_)
+    {
+        human.cat_ = Human::Category::OK;
+    }
+    for (auto &zombie: data_.zombies_)
+    {
+        zombie.appealFactor_ = -1;
+    }
+    clusters_.build(data_.zombies_, params_.neighbourhoodRadius_);
+}
+
+Position GameController::playTurn()
+{
+    Position solution;
+    chooseStrategy();
+    switch (state_)
+    {
+        case normalMode:
+        {
+            if (ponderer_ && ponderer_->advise(data_, solution))
+                break;
+            solution = attackMostDenseZombie();
+            break;
+        }
+        case cleanupMode:
+        {
+            if (ponderer_ && ponderer_->advise(data_, solution))
+                break;
+            if (advisor_ && advisor_->advise(data_, solution))
+                break;
+            solution = cleanupStrategy();
+            break;
+        }
+        case rescueEndangered:
+        {
+            solution = goToClosestEndangered();
+            break;
+        }
+        case rescueHuman:
+        {
+            solution = rescueMissionStrategy();
+            break;
+        }
+    }
+    return solution;
 }
 
 void GameController::writeSolution(Position sol)
 {
+    PROFILE_PHASE(writeSolution);
     cout << sol.x_ << " " << sol.y_ << endl;
 }
 
 void GameController::chooseStrategy()
 {
+    PROFILE_PHASE(chooseStrategy);
     if (data_.humanCount_ == 1)
     {
         state_ = rescueHuman;
@@ -197,7 +307,7 @@ void GameController::chooseStrategy()
     if (atLeastOneHumanIsSave())
     {
         rateZombies();
-        state_ = normalMode;
+        state_ = allHumansSafe() ? cleanupMode : normalMode;
     }
     else
     {
@@ -206,42 +316,61 @@ void GameController::chooseStrategy()
 }
 void GameController::doTheTriage()
 {
-    doTheTriage(data_.humans_);
+    PROFILE_PHASE(doTheTriage);
+    PROFILE_COUNT(humansScanned, data_.humans_.size());
+    humanQueue_.update(data_);
+    for (auto &human: data_.humans_)
+    {
+        HumanQueue::Entry const* entry = humanQueue_.find(human.id_);
+        human.cat_ = triageCategory(entry->deathTurns_, entry->coverTurns_);
+    }
 }
 
-void GameController::doTheTriage(set<Human> &humans)
+void GameController::doTheTriage(FlatSet<Human> &humans)
 {
+    PROFILE_PHASE(doTheTriage);
+    PROFILE_COUNT(humansScanned, humans.size());
     for (auto &human: humans)
     {
         Zombie nearestZombie = findNearestZombie(
             human.pos_, data_.zombies_);
         int zombieSteps = Helpers::steps(human,
             nearestZombie);
-        if (zombieSteps <= 0)
-        {
-            human.cat_ = Human::Category::Lost;
-            continue;
-        }
-        int ashSteps = Helpers::steps(human,
-            data_.ashPos_);
-        int diffSteps = zombieSteps - ashSteps;
-        if (diffSteps <= 0)
-        {
-            human.cat_ = Human::Category::Lost;
-        }
-        else if (diffSteps <= 2)
-        {
-            human.cat_ = Human::Category::Endangered;
-        }
+        int ashSteps = min(Helpers::steps(human, data_.ashPos_),
+            Helpers::steps(data_.ashPos_, nearestZombie));
+        human.cat_ = triageCategory(zombieSteps, ashSteps);
     }
 }
 
+HumanQueue &GameController::getHumanQueue()
+{
+    return humanQueue_;
+}
+
+ZombieClusters &GameController::getClusters()
+{
+    return clusters_;
+}
+
+Human::Category GameController::triageCategory(
+    int zombieSteps, int ashSteps)
+{
+    if (zombieSteps <= 0)
+        return Human::Category::Lost;
+    int diffSteps = zombieSteps - ashSteps;
+    if (diffSteps <= 0)
+        return Human::Category::Lost;
+    if (diffSteps <= params_.endangeredSteps_)
+        return Human::Category::Endangered;
+    return Human::Category::OK;
+}
+
 bool GameController::atLeastOneHumanIsSave()
 {
     return atLeastOneHumanIsSave(data_.humans_);
 }
 
-bool GameController::atLeastOneHumanIsSave(set<Human> const &humans)
+bool GameController::atLeastOneHumanIsSave(FlatSet<Human> const &humans)
 {
     for (auto human: humans)
     {
@@ -253,13 +382,26 @@ bool GameController::atLeastOneHumanIsSave(set<Human> const &humans)
     return false;
 }
 
+bool GameController::allHumansSafe()
+{
+    for (auto const &human: data_.humans_)
+    {
+        if (human.cat_ != Human::Category::OK)
+            return false;
+    }
+    return true;
+}
+
 void GameController::rateZombies()
 {
     rateZombies(data_.zombies_);
 }
 
-void GameController::rateZombies(set<Zombie> &zombies)
+void GameController::rateZombies(FlatSet<Zombie> &zombies)
 {
+    PROFILE_PHASE(rateZombies);
+    PROFILE_COUNT(zombiesScanned, zombies.size()*zombies.size());
+    PROFILE_COUNT(humansScanned, zombies.size()*data_.humans_.size());
     for (auto &zombie: zombies)
     {
         double totalFactor = 0;
@@ -272,7 +414,7 @@ void GameController::rateZombies(set<Zombie> &zombies)
             double distSqr = pow(
                 Helpers::distance(zombPos, zom),2);
             distSqr += safeFactor;
-            totalFactor += Helpers::zombieFactor/distSqr;
+            totalFactor += params_.zombieFactor_/distSqr;
         }
         for (auto hum: data_.humans_)
         {
@@ -281,20 +423,20 @@ void GameController::rateZombies(set<Zombie> &zombies)
             double distSqr = pow(
                 Helpers::distance(zombPos, hum),2);
             distSqr += safeFactor;
-            totalFactor += Helpers::humanFactor/distSqr;
+            totalFactor += params_.humanFactor_/distSqr;
             }
             else if (hum.cat_ == Human::Category::Endangered)
             {
             double distSqr = pow(
                 Helpers::distance(zombPos, hum),2);
             distSqr += safeFactor;
-            totalFactor += Helpers::endangeredFactor/distSqr;
+            totalFactor += params_.endangeredFactor_/distSqr;
             }
         }
         double distSqr = pow(
             Helpers::distance(data_.ashPos_, zombPos),2);
         distSqr += safeFactor;
-        totalFactor += Helpers::ashFactor/distSqr;
+        totalFactor += params_.ashFactor_/distSqr;
         zombie.appealFactor_ = totalFactor;
     }
 }
@@ -315,10 +457,7 @@ Position GameController::rescueMissionStrategy()
     {
         Zombie nearest = findNearestZombie(
             data_.ashPos_, data_.zombies_);
-        Position zombieCenter = centerOfMass(
-            selectZombiesFromNeighbourhood(
-                nearest, data_.zombies_));
-        return zombieCenter;
+        return neighbourhoodCenter(nearest);
     }
     else
     {
@@ -329,41 +468,92 @@ Position GameController::rescueMissionStrategy()
 Position GameController::goToClosestEndangered()
 {
     Position target;
+    bool found = false;
+    int mostUrgent = 0;
+    rescueTargets_.clear();
     for (auto human: data_.humans_)
     {
-        if (human.cat_ == Human::Category::Endangered)
+        if (human.cat_ != Human::Category::Endangered)
+            continue;
+        HumanQueue::Entry const* entry = humanQueue_.find(human.id_);
+        int deathTurns = entry ? entry->deathTurns_ : 0;
+        RescueTarget rescueTarget = {human.id_, human.pos_, deathTurns,
+            {RescueTarget::noIntercept, human.pos_}};
+        auto threat = data_.zombies_.end();
+        if (entry)
+            threat = data_.zombies_.find(
+                Zombie(entry->nearestZombie_, Position(), Position()));
+        if (threat != data_.zombies_.end())
+            rescueTarget.intercept_ = Intercept::solve(data_.ashPos_, *threat);
+        rescueTargets_.push_back(rescueTarget);
+        if (!found || deathTurns < mostUrgent)
         {
             target = human.pos_;
-            break;
+            mostUrgent = deathTurns;
+            found = true;
         }
     }
+    RescuePlan const &plan = rescue_.schedule(
+        data_.ashPos_, rescueTargets_);
+    if (!plan.waypoints_.empty())
+        target = plan.waypoints_.front();
     return target;
 }
 
 Position GameController::attackMostDenseZombie()
 {
+    PROFILE_PHASE(attackMostDenseZombie);
     Zombie bestZombie = findZombieWithHighestAppealFactor(
         data_.zombies_);
-    Position zombieCenter = centerOfMass(
-            selectZombiesFromNeighbourhood(
-                bestZombie, data_.zombies_));
+    Position zombieCenter = neighbourhoodCenter(bestZombie);
+    // The single-shot check and the destination heatmap both read the
+    // predicted paths.
+    trajectories_.update(data_);
+    singleShotAhead(bestZombie, zombieCenter);
     Position vec = VectorOpers::subtract(
         zombieCenter, data_.ashPos_);
     vec = VectorOpers::resize(vec, Helpers::ashStepSize);
-    double bestAngle = chooseBestAngle(vec, data_.zombies_);
-    vec = VectorOpers::rotate(vec, bestAngle);
-    Position calculatedPos = calcDestination(
-        data_.ashPos_, vec);
-    if (DEBUG_PRINT)
+    Position calculatedPos = chooseDestination(vec);
+    if (verbose_)
     {
-        cerr << "bestAngle: " << bestAngle << endl;
+        cerr << "destination: " << calculatedPos.x_ << " "
+            << calculatedPos.y_ << endl;
     }
     return calculatedPos;
 }
 
+// Aims at the point from which the whole neighbourhood of the zombie can
+// be shot at once, when its predicted paths bring it inside a single
+// shooting range within singleShotHorizon turns.
+bool GameController::singleShotAhead(Zombie zombie, Position &goal)
+{
+    clusters_.neighbourhood(zombie.nextPos_, groupIds_);
+    int turn = enclosing_.firstSingleShot(trajectories_, groupIds_,
+        singleShotHorizon);
+    if (turn < 1)
+        return false;
+    goal = enclosing_.shotPoint();
+    return true;
+}
+
+Position GameController::cleanupStrategy()
+{
+    int largest = clusters_.largest();
+    if (largest >= 0 && clusters_.size(largest) > cleanupMaxCluster)
+        return attackMostDenseZombie();
+    PROFILE_PHASE(planCleanup);
+    cleanup_.plan(data_, cleanupEvaluations);
+    if (verbose_)
+    {
+        cerr << "cleanup: " << cleanup_.getTurns() << " turns" << endl;
+    }
+    return cleanup_.getFirstMove();
+}
+
 Zombie GameController::findNearestZombie(
-    Position pos, set<Zombie> const &zombies)
+    Position pos, FlatSet<Zombie> const &zombies)
 {
+    PROFILE_COUNT(zombiesScanned, zombies.size());
     double minDist = MAX_DIST;
     Zombie nearestZombie;
 
@@ -380,7 +570,7 @@ Zombie GameController::findNearestZombie(
 }
 
 Zombie GameController::findZombieWithHighestAppealFactor(
-    set<Zombie> const & zombies)
+    FlatSet<Zombie> const & zombies)
 {
     double maxAppeal = 0;
     Zombie bestZombie;
@@ -395,20 +585,9 @@ Zombie GameController::findZombieWithHighestAppealFactor(
     return bestZombie;
 }
 
-vector<Zombie> GameController::selectZombiesFromNeighbourhood(
-    Zombie refZombie, set<Zombie> const &zombies)
+Position GameController::neighbourhoodCenter(Zombie zombie)
 {
-    vector<Zombie> neighbours;
-    Position refPos = refZombie.nextPos_;
-    for (auto zombie: zombies)
-    {
-        double dist = Helpers::distance(refPos, zombie);
-        if (dist < Helpers::neighbourhoodRadius)
-        {
-            neighbours.push_back(zombie);
-        }
-    }
-    return neighbours;
+    return clusters_.neighbourhoodCentroid(zombie.nextPos_);
 }
 
 Position GameController::centerOfMass(vector<Position> const &positions)
@@ -429,12 +608,18 @@ Position GameController::centerOfMass(vector<Position> const &positions)
 
 Position GameController::centerOfMass(vector<Zombie> const &zombies)
 {
-    vector<Position> positions;
+    if (zombies.size() == 0)
+        return Position(0,0);
+    int xCenter = 0;
+    int yCenter = 0;
     for (auto zombie: zombies)
     {
-        positions.push_back(zombie.nextPos_);
+        xCenter += zombie.nextPos_.x_;
+        yCenter += zombie.nextPos_.y_;
     }
-    return centerOfMass(positions);
+    xCenter = xCenter/zombies.size();
+    yCenter = yCenter/zombies.size();
+    return Position(xCenter, yCenter);
 }
 
 Position GameController::calcDestination(
@@ -445,8 +630,9 @@ Position GameController::calcDestination(
 }
 
 int GameController::countZombiesInRange(
-    Position pos, set<Zombie> const &zombies)
+    Position pos, FlatSet<Zombie> const &zombies)
 {
+    PROFILE_COUNT(zombiesScanned, zombies.size());
     int numZombies = 0;
     for (auto zombie: zombies)
     {
@@ -460,26 +646,19 @@ int GameController::countZombiesInRange(
     return numZombies;
 }
 
-double GameController::chooseBestAngle(
-    Position vec, set<Zombie> const &zombies)
+Position GameController::chooseDestination(Position vec)
 {
-    int bestZombiesCount = countZombiesInRange(
-        data_.ashPos_, data_.zombies_);
-    if (bestZombiesCount == 0)
-        return 0.0;
-    double bestAngle = 0.0;
-    for (double angle=-0.5; angle<=0.5; angle=angle+0.1)
-    {
-        Position newVec = VectorOpers::rotate(vec,angle);
-        Position dest = calcDestination(data_.ashPos_, newVec);
-        int zomCount = countZombiesInRange(dest, data_.zombies_);
-        if (zomCount > bestZombiesCount)
-        {
-            bestZombiesCount = zomCount;
-            bestAngle = angle;
-        }
-    }
-    return bestAngle;
+    PROFILE_PHASE(searchDestination);
+    Position preferred = calcDestination(data_.ashPos_, vec);
+    int killsHere = countZombiesInRange(data_.ashPos_, data_.zombies_);
+    if (killsHere == 0)
+        return preferred;
+    heatmap_.build(data_, trajectories_);
+    Position destination = destinations_.search(data_.ashPos_, preferred,
+        data_.zombies_, destinationEvaluations, &heatmap_);
+    if (destinations_.getBestKills() <= killsHere)
+        return preferred;
+    return destination;
 }
 
 GameData GameController::getData()
@@ -487,7 +666,38 @@ GameData GameController::getData()
     return data_;
 }
 
-void GameController::debugPrint(GameData data)
+void GameController::setParams(StrategyParams params)
+{
+    params_ = params;
+    clusters_.build(data_.zombies_, params_.neighbourhoodRadius_);
+}
+
+StrategyParams GameController::getParams()
+{
+    return params_;
+}
+
+void GameController::setVerbose(bool verbose)
+{
+    verbose_ = verbose;
+}
+
+void GameController::setListener(TurnListener* listener)
+{
+    listener_ = listener;
+}
+
+void GameController::setAdvisor(MoveAdvisor* advisor)
+{
+    advisor_ = advisor;
+}
+
+void GameController::setPonderer(Ponderer* ponderer)
+{
+    ponderer_ = ponderer;
+}
+
+void GameController::debugPrint(GameData const &data)
 {
     cerr << "AshPos: " << data.ashPos_.x_
         << " " << data.ashPos_.y_ << endl;
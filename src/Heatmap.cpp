@@ -0,0 +1,116 @@
+#include "Heatmap.hpp"
+
+using namespace std;
+
+const int KillHeatmap::cellSize;
+
+KillHeatmap::KillHeatmap(int turns):
+    turns_(turns),
+    columns_((Helpers::mapWidth + cellSize - 1)/cellSize),
+    rows_((Helpers::mapHeight + cellSize - 1)/cellSize)
+{
+    int radius = Helpers::shootingRadius/cellSize;
+    for (int dy = 0; dy <= radius; dy++)
+    {
+        halfWidth_.push_back(sqrt(double(radius*radius - dy*dy)));
+    }
+}
+
+void KillHeatmap::build(GameData const &data, TrajectoryCache &trajectories)
+{
+    int cells = columns_*rows_;
+    int radius = halfWidth_.size() - 1;
+    int width = columns_ + 1;
+    counts_.resize((turns_ + 1)*cells);
+    for (int turn = 0; turn <= turns_; turn++)
+    {
+        // Every zombie opens and closes one run of cells per disk row;
+        // a running sum along each row turns the runs into counts.
+        runs_.assign(rows_*width, 0);
+        for (auto const &zombie: data.zombies_)
+        {
+            Position pos = turn == 0 ? zombie.pos_
+                : trajectories.positionAt(zombie.id_, turn);
+            int cell = cellOf(pos);
+            int column = cell % columns_;
+            int row = cell / columns_;
+            int top = max(row - radius, 0);
+            int bottom = min(row + radius, rows_ - 1);
+            for (int r = top; r <= bottom; r++)
+            {
+                int half = halfWidth_[abs(r - row)];
+                runs_[r*width + max(column - half, 0)]++;
+                runs_[r*width + min(column + half + 1, columns_)]--;
+            }
+        }
+        int* counts = &counts_[turn*cells];
+        for (int row = 0; row < rows_; row++)
+        {
+            int total = 0;
+            for (int column = 0; column < columns_; column++)
+            {
+                total += runs_[row*width + column];
+                counts[row*columns_ + column] = total;
+            }
+        }
+    }
+}
+
+int KillHeatmap::getTurns()
+{
+    return turns_;
+}
+
+int KillHeatmap::countAt(int turn, Position pos)
+{
+    return counts_[turn*columns_*rows_ + cellOf(pos)];
+}
+
+Position KillHeatmap::bestReachableCell(int turn, Position ash, int &count)
+{
+    int cells = columns_*rows_;
+    int* counts = &counts_[turn*cells];
+    int home = cellOf(ash);
+    int homeColumn = home % columns_;
+    int homeRow = home / columns_;
+    int bestColumn = homeColumn;
+    int bestRow = homeRow;
+    count = counts[home];
+    double bestDist = Helpers::distance(ash, centre(homeColumn, homeRow));
+    double reach = double(Helpers::ashStepSize)*turn;
+    int span = reach/cellSize + 1;
+    for (int row = max(homeRow - span, 0);
+        row <= min(homeRow + span, rows_ - 1); row++)
+    {
+        for (int column = max(homeColumn - span, 0);
+            column <= min(homeColumn + span, columns_ - 1); column++)
+        {
+            int cellCount = counts[row*columns_ + column];
+            if (cellCount < count)
+                continue;
+            double dist = Helpers::distance(ash, centre(column, row));
+            if (dist > reach)
+                continue;
+            if (cellCount > count || dist < bestDist)
+            {
+                count = cellCount;
+                bestDist = dist;
+                bestColumn = column;
+                bestRow = row;
+            }
+        }
+    }
+    return centre(bestColumn, bestRow);
+}
+
+int KillHeatmap::cellOf(Position pos)
+{
+    int column = min(max(pos.x_/cellSize, 0), columns_ - 1);
+    int row = min(max(pos.y_/cellSize, 0), rows_ - 1);
+    return row*columns_ + column;
+}
+
+Position KillHeatmap::centre(int column, int row)
+{
+    return Position(column*cellSize + cellSize/2, row*cellSize + cellSize/2);
+}
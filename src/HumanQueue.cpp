@@ -0,0 +1,208 @@
+#include "HumanQueue.hpp"
+
+using namespace std;
+
+namespace
+{
+const int neverEaten = 1 << 20;
+const double noZombie = 1e9;
+// Flooring both coordinates can lengthen a step by up to sqrt(2).
+const double maxZombieMove = Helpers::zombieStepSize + 2;
+}
+
+HumanQueue::HumanQueue(): rescans_(0)
+{}
+
+void HumanQueue::update(GameData const &data)
+{
+    rescans_ = 0;
+    double maxMove = 0;
+    if (!isConsecutive(data, maxMove))
+        clear();
+
+    unsigned kept = 0;
+    for (unsigned i = 0; i < heap_.size(); i++)
+    {
+        Entry &entry = heap_[i];
+        if (data.humans_.count(Human(entry.humanId_, Position())) == 0)
+        {
+            index_[entry.humanId_] = -1;
+            continue;
+        }
+        heap_[kept++] = entry;
+    }
+    heap_.resize(kept);
+    for (unsigned i = 0; i < heap_.size(); i++)
+    {
+        index_[heap_[i].humanId_] = i;
+    }
+
+    for (auto human: data.humans_)
+    {
+        if (human.id_ >= int(index_.size()))
+            index_.resize(human.id_ + 1, -1);
+        if (index_[human.id_] < 0)
+        {
+            Entry entry;
+            entry.humanId_ = human.id_;
+            index_[human.id_] = heap_.size();
+            heap_.push_back(entry);
+            rescan(heap_.back(), human, data);
+        }
+        else
+        {
+            Entry &entry = heap_[index_[human.id_]];
+            entry.secondBound_ -= maxMove;
+            auto nearest = data.zombies_.find(
+                Zombie(entry.nearestZombie_, Position(), Position()));
+            if (nearest == data.zombies_.end()
+                || Helpers::distance(human.pos_, *nearest)
+                    > entry.secondBound_)
+                rescan(entry, human, data);
+            else
+                entry.deathTurns_ = Helpers::steps(human, *nearest);
+        }
+        Entry &entry = heap_[index_[human.id_]];
+        entry.coverTurns_ = Helpers::steps(human, data.ashPos_);
+        auto nearest = data.zombies_.find(
+            Zombie(entry.nearestZombie_, Position(), Position()));
+        if (nearest != data.zombies_.end())
+            entry.coverTurns_ = min(entry.coverTurns_,
+                Helpers::steps(data.ashPos_, *nearest));
+    }
+
+    for (int i = int(heap_.size())/2 - 1; i >= 0; i--)
+    {
+        siftDown(i);
+    }
+
+    zombieAlive_.assign(zombieAlive_.size(), false);
+    for (auto zombie: data.zombies_)
+    {
+        if (zombie.id_ >= int(zombiePos_.size()))
+        {
+            zombiePos_.resize(zombie.id_ + 1);
+            zombieAlive_.resize(zombie.id_ + 1, false);
+        }
+        zombiePos_[zombie.id_] = zombie.nextPos_;
+        zombieAlive_[zombie.id_] = true;
+    }
+}
+
+void HumanQueue::clear()
+{
+    for (auto &entry: heap_)
+    {
+        index_[entry.humanId_] = -1;
+    }
+    heap_.clear();
+}
+
+int HumanQueue::size()
+{
+    return heap_.size();
+}
+
+bool HumanQueue::empty()
+{
+    return heap_.empty();
+}
+
+HumanQueue::Entry const &HumanQueue::top()
+{
+    return heap_.front();
+}
+
+HumanQueue::Entry const &HumanQueue::at(int index)
+{
+    return heap_[index];
+}
+
+HumanQueue::Entry const* HumanQueue::find(int humanId)
+{
+    if (humanId < 0 || humanId >= int(index_.size()) || index_[humanId] < 0)
+        return 0;
+    return &heap_[index_[humanId]];
+}
+
+int HumanQueue::getRescans()
+{
+    return rescans_;
+}
+
+bool HumanQueue::isConsecutive(GameData const &data, double &maxMove)
+{
+    for (auto zombie: data.zombies_)
+    {
+        if (zombie.id_ >= int(zombiePos_.size()) || !zombieAlive_[zombie.id_])
+            return false;
+        double move = Helpers::distance(
+            zombiePos_[zombie.id_], zombie.nextPos_);
+        if (move > maxZombieMove)
+            return false;
+        maxMove = max(maxMove, move);
+    }
+    return true;
+}
+
+void HumanQueue::rescan(Entry &entry, Human const &human,
+    GameData const &data)
+{
+    PROFILE_COUNT(zombiesScanned, data.zombies_.size());
+    rescans_++;
+    entry.nearestZombie_ = -1;
+    entry.deathTurns_ = neverEaten;
+    double nearestDist = noZombie;
+    entry.secondBound_ = noZombie;
+    Zombie nearest;
+    for (auto zombie: data.zombies_)
+    {
+        double dist = Helpers::distance(human.pos_, zombie);
+        if (dist < nearestDist)
+        {
+            entry.secondBound_ = nearestDist;
+            nearestDist = dist;
+            nearest = zombie;
+            entry.nearestZombie_ = zombie.id_;
+        }
+        else if (dist < entry.secondBound_)
+        {
+            entry.secondBound_ = dist;
+        }
+    }
+    if (entry.nearestZombie_ >= 0)
+        entry.deathTurns_ = Helpers::steps(human, nearest);
+}
+
+void HumanQueue::siftDown(int index)
+{
+    int size = heap_.size();
+    while (true)
+    {
+        int smallest = index;
+        int left = 2*index + 1;
+        int right = left + 1;
+        if (left < size && before(left, smallest))
+            smallest = left;
+        if (right < size && before(right, smallest))
+            smallest = right;
+        if (smallest == index)
+            return;
+        swapEntries(index, smallest);
+        index = smallest;
+    }
+}
+
+bool HumanQueue::before(int a, int b)
+{
+    if (heap_[a].deathTurns_ != heap_[b].deathTurns_)
+        return heap_[a].deathTurns_ < heap_[b].deathTurns_;
+    return heap_[a].humanId_ < heap_[b].humanId_;
+}
+
+void HumanQueue::swapEntries(int a, int b)
+{
+    swap(heap_[a], heap_[b]);
+    index_[heap_[a].humanId_] = a;
+    index_[heap_[b].humanId_] = b;
+}
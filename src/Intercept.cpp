@@ -0,0 +1,47 @@
+#include "Intercept.hpp"
+
+using namespace std;
+
+namespace
+{
+// Keeps a root that lands on an integer from being rounded up a turn.
+const double rootTolerance = 1e-7;
+}
+
+double Intercept::earliestTime(Position ash, Position zombie,
+    Position velocity)
+{
+    double dx = zombie.x_ - ash.x_;
+    double dy = zombie.y_ - ash.y_;
+    double vx = velocity.x_;
+    double vy = velocity.y_;
+    double speed = Helpers::ashStepSize;
+    double range = Helpers::shootingRadius;
+    double a = vx*vx + vy*vy - speed*speed;
+    double b = 2*(dx*vx + dy*vy) - 2*range*speed;
+    double c = dx*dx + dy*dy - range*range;
+    double root = (-b - sqrt(b*b - 4*a*c))/(2*a);
+    return c <= 0 ? 0.0 : max(root, 0.0);
+}
+
+Interception Intercept::solve(Position ash, Zombie const &zombie)
+{
+    Position velocity = VectorOpers::subtract(zombie.nextPos_, zombie.pos_);
+    double time = earliestTime(ash, zombie.pos_, velocity);
+    Interception result;
+    result.turns_ = ceil(time - rootTolerance);
+    result.point_ = Position(zombie.pos_.x_ + velocity.x_*result.turns_,
+        zombie.pos_.y_ + velocity.y_*result.turns_);
+    return result;
+}
+
+void Intercept::solveAll(Position ash, FlatSet<Zombie> const &zombies,
+    vector<Interception> &out)
+{
+    out.resize(zombies.size());
+    unsigned i = 0;
+    for (auto const &zombie: zombies)
+    {
+        out[i++] = solve(ash, zombie);
+    }
+}
@@ -0,0 +1,143 @@
+#include "PerfCounters.hpp"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+PerfCounters::PerfCounters(): leader_(-1), members_(0)
+{
+    for (int e = 0; e < eventCount; e++)
+    {
+        fds_[e] = -1;
+    }
+#ifdef __linux__
+    openEvent(cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    openEvent(instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    openEvent(l1dMisses, PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D
+        | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+        | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    openEvent(llcMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    openEvent(branchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (int e = 0; e < eventCount; e++)
+    {
+        if (fds_[e] >= 0)
+            close(fds_[e]);
+    }
+#endif
+}
+
+bool PerfCounters::isAvailable(Event event)
+{
+    return fds_[event] >= 0;
+}
+
+bool PerfCounters::anyAvailable()
+{
+    for (int e = 0; e < eventCount; e++)
+    {
+        if (fds_[e] >= 0)
+            return true;
+    }
+    return false;
+}
+
+void PerfCounters::start()
+{
+#ifdef __linux__
+    if (leader_ < 0)
+        return;
+    ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+// With PERF_FORMAT_GROUP the leader reads the member count, the enabled and
+// running times and then one value per member in the order they joined.
+PerfCounters::Sample PerfCounters::stop()
+{
+    Sample sample;
+    sample.timeEnabled_ = 0;
+    sample.timeRunning_ = 0;
+    for (int e = 0; e < eventCount; e++)
+    {
+        sample.values_[e] = 0;
+    }
+#ifdef __linux__
+    if (leader_ < 0)
+        return sample;
+    ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    uint64_t buffer[3 + eventCount];
+    ssize_t expected = (3 + members_)*sizeof(uint64_t);
+    if (read(leader_, buffer, sizeof(buffer)) != expected
+        || buffer[0] != uint64_t(members_))
+        return sample;
+    sample.timeEnabled_ = buffer[1];
+    sample.timeRunning_ = buffer[2];
+    if (sample.timeRunning_ == 0)
+        return sample;
+    double scale = double(sample.timeEnabled_)/sample.timeRunning_;
+    for (int m = 0; m < members_; m++)
+    {
+        uint64_t value = buffer[3 + m];
+        if (sample.timeRunning_ < sample.timeEnabled_)
+            value = uint64_t(value*scale + 0.5);
+        sample.values_[order_[m]] = value;
+    }
+#endif
+    return sample;
+}
+
+int PerfCounters::openEvent(Event event, uint32_t type, uint64_t config)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = leader_ < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+        | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    int fd = syscall(__NR_perf_event_open, &attr, 0, -1, leader_, 0);
+    if (fd < 0)
+        return fd;
+    if (leader_ < 0)
+        leader_ = fd;
+    fds_[event] = fd;
+    order_[members_++] = event;
+    return fd;
+#else
+    (void)event;
+    (void)type;
+    (void)config;
+    return -1;
+#endif
+}
+
+const char* PerfCounters::eventName(Event event)
+{
+    static const char* names[eventCount] = {
+        "cycles",
+        "instructions",
+        "L1d-misses",
+        "LLC-misses",
+        "branch-misses"
+    };
+    return names[event];
+}
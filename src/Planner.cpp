@@ -0,0 +1,146 @@
+#include "Planner.hpp"
+
+using namespace std;
+
+namespace
+{
+const int maxLegs = 3;
+const int maxLegTurns = 8;
+const unsigned mutationWindow = 10;
+}
+
+Planner::Planner(unsigned seed):
+    rng_(seed), bestScore_(0), iterations_(0), maxIterations_(0), stop_(false)
+{
+    best_.reserve(Rules::maxTurns + maxLegs*maxLegTurns);
+}
+
+void Planner::reset()
+{
+    best_.clear();
+    bestScore_ = 0;
+    iterations_ = 0;
+}
+
+Position Planner::plan(GameData const &data, double budgetMs)
+{
+    TRACE_SCOPE("plan", "planner");
+    resume();
+    search(data, budgetMs);
+    if (best_.empty())
+        return data.ashPos_;
+    Position move = best_.front();
+    best_.erase(best_.begin());
+    return move;
+}
+
+void Planner::search(GameData const &data, double budgetMs)
+{
+    auto deadline = chrono::steady_clock::now()
+        + chrono::duration_cast<chrono::steady_clock::duration>(
+            chrono::duration<double, milli>(budgetMs));
+    root_.load(data);
+    arena_.reset();
+    ScratchVector<Position> candidate{ArenaAllocator<Position>(&arena_)};
+    candidate.reserve(Rules::maxTurns + maxLegs*maxLegTurns);
+    iterations_ = 0;
+    bestScore_ = -1;
+    if (!best_.empty())
+    {
+        candidate.assign(best_.begin(), best_.end());
+        bestScore_ = rollout(candidate);
+        best_.assign(candidate.begin(), candidate.end());
+        iterations_++;
+    }
+    while (!stop_ && (maxIterations_ <= 0 || iterations_ < maxIterations_)
+        && (iterations_ == 0 || chrono::steady_clock::now() < deadline))
+    {
+        candidate.clear();
+        if (!best_.empty() && rng_() % 2)
+        {
+            candidate.assign(best_.begin(), best_.end());
+            mutate(candidate);
+        }
+        else
+        {
+            randomLegs(candidate);
+        }
+        int score = rollout(candidate);
+        iterations_++;
+        if (score > bestScore_)
+        {
+            bestScore_ = score;
+            best_.assign(candidate.begin(), candidate.end());
+        }
+    }
+    Trace::counter("rollouts", iterations_);
+    Trace::counter("bestScore", bestScore_);
+}
+
+void Planner::setMaxIterations(int maxIterations)
+{
+    maxIterations_ = maxIterations;
+}
+
+void Planner::stop()
+{
+    stop_ = true;
+}
+
+void Planner::resume()
+{
+    stop_ = false;
+}
+
+int Planner::getIterations()
+{
+    return iterations_;
+}
+
+int Planner::getBestScore()
+{
+    return bestScore_;
+}
+
+vector<Position> Planner::getBestPlan()
+{
+    return best_;
+}
+
+// A stopped rollout scores -1, so it never replaces the best line.
+int Planner::rollout(ScratchVector<Position> &moves)
+{
+    sim_ = root_;
+    unsigned turn = 0;
+    while (!sim_.isOver())
+    {
+        if (stop_)
+            return -1;
+        if (turn == moves.size())
+            moves.push_back(sim_.nearestZombie());
+        sim_.step(moves[turn++]);
+    }
+    moves.resize(turn);
+    return sim_.getScore();
+}
+
+void Planner::randomLegs(ScratchVector<Position> &moves)
+{
+    int legs = rng_() % (maxLegs + 1);
+    for (int leg = 0; leg < legs; leg++)
+    {
+        moves.insert(moves.end(), 1 + rng_() % maxLegTurns, randomPosition());
+    }
+}
+
+void Planner::mutate(ScratchVector<Position> &moves)
+{
+    unsigned start = rng_() % min<unsigned>(moves.size(), mutationWindow);
+    moves.resize(start);
+    moves.insert(moves.end(), 1 + rng_() % maxLegTurns, randomPosition());
+}
+
+Position Planner::randomPosition()
+{
+    return Position(rng_() % Rules::mapWidth, rng_() % Rules::mapHeight);
+}
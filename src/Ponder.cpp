@@ -0,0 +1,190 @@
+#include "Ponder.hpp"
+
+using namespace std;
+
+namespace
+{
+double msUntil(chrono::steady_clock::time_point deadline)
+{
+    return chrono::duration<double, milli>(
+        deadline - chrono::steady_clock::now()).count();
+}
+
+chrono::steady_clock::time_point msFromNow(double ms)
+{
+    return chrono::steady_clock::now()
+        + chrono::duration_cast<chrono::steady_clock::duration>(
+            chrono::duration<double, milli>(ms));
+}
+}
+
+const int PonderingPlanner::defaultTurnBudgetMs;
+const int PonderingPlanner::maxPonderMs;
+
+PonderingPlanner::PonderingPlanner(double turnBudgetMs, unsigned seed):
+    planner_(seed), pondering_(false), quit_(false), pondered_(false),
+    stop_(false),
+    predictedBaseline_(-1), baseline_(-1), hasPlan_(false),
+    turnBudgetMs_(turnBudgetMs), hits_(0), misses_(0), ponderedRollouts_(0),
+    plannedTurns_(0)
+{
+    baselineGame_.setVerbose(false);
+    baselineGame_.setAdvisor(&baselineEndgame_);
+}
+
+PonderingPlanner::~PonderingPlanner()
+{
+    join();
+    {
+        lock_guard<mutex> lock(mutex_);
+        quit_ = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void PonderingPlanner::ponder(GameData const &data, Position move)
+{
+    join();
+    if (!hasPlan_ || planned_.x_ != move.x_ || planned_.y_ != move.y_)
+        planner_.reset();
+    hasPlan_ = false;
+    baseline_ = -1;
+    monitor_.predict(data, move);
+    GameData const &predicted = monitor_.getPrediction();
+    if (predicted.zombies_.empty() || predicted.humans_.empty())
+        return;
+    if (!thread_.joinable())
+        thread_ = thread(&PonderingPlanner::work, this);
+    stop_ = false;
+    planner_.resume();
+    {
+        lock_guard<mutex> lock(mutex_);
+        pondering_ = true;
+    }
+    pondered_ = true;
+    wake_.notify_one();
+}
+
+void PonderingPlanner::collect(GameData const &data)
+{
+    if (!pondered_)
+        return;
+    join();
+    if (monitor_.check(data))
+    {
+        hits_++;
+        baseline_ = predictedBaseline_;
+        return;
+    }
+    misses_++;
+    planner_.reset();
+}
+
+bool PonderingPlanner::advise(GameData const &data, Position &move)
+{
+    join();
+    TimePoint deadline = msFromNow(turnBudgetMs_);
+    stop_ = false;
+    int baseline = baseline_;
+    baseline_ = -1;
+    if (baseline < 0)
+        baseline = playBaseline(data, deadline);
+    double remainingMs = msUntil(deadline);
+    if (baseline < 0 || remainingMs <= 0)
+        return false;
+    Position next = planner_.plan(data, remainingMs);
+    if (planner_.getBestScore() <= baseline)
+        return false;
+    move = next;
+    planned_ = next;
+    hasPlan_ = true;
+    plannedTurns_++;
+    return true;
+}
+
+void PonderingPlanner::report(ostream &out)
+{
+    out << "Pondering: " << hits_ << " hits, " << misses_ << " misses, "
+        << ponderedRollouts_ << " rollouts while waiting, "
+        << plannedTurns_ << " planned turns" << endl;
+}
+
+Planner &PonderingPlanner::getPlanner()
+{
+    return planner_;
+}
+
+int PonderingPlanner::getHits()
+{
+    return hits_;
+}
+
+int PonderingPlanner::getMisses()
+{
+    return misses_;
+}
+
+int PonderingPlanner::getPonderedRollouts()
+{
+    return ponderedRollouts_;
+}
+
+int PonderingPlanner::getPlannedTurns()
+{
+    return plannedTurns_;
+}
+
+void PonderingPlanner::work()
+{
+    Trace::setThreadName("ponder");
+    unique_lock<mutex> lock(mutex_);
+    while (true)
+    {
+        wake_.wait(lock, [this]() { return pondering_ || quit_; });
+        if (quit_)
+            return;
+        lock.unlock();
+        TimePoint deadline = msFromNow(maxPonderMs);
+        GameData const &predicted = monitor_.getPrediction();
+        predictedBaseline_ = playBaseline(predicted, deadline);
+        if (predictedBaseline_ >= 0)
+            planner_.search(predicted, msUntil(deadline));
+        lock.lock();
+        pondering_ = false;
+        done_.notify_all();
+    }
+}
+
+// Stops the worker and waits for it to go idle; the flags are raised
+// before waiting, so a playout or rollout in progress ends within a turn.
+void PonderingPlanner::join()
+{
+    if (!pondered_)
+        return;
+    pondered_ = false;
+    stop_ = true;
+    planner_.stop();
+    unique_lock<mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return !pondering_; });
+    if (predictedBaseline_ >= 0)
+        ponderedRollouts_ += planner_.getIterations();
+}
+
+// Score of the built-in strategy played out from data on the Simulator,
+// or -1 once the deadline passes or stop_ is raised.
+int PonderingPlanner::playBaseline(GameData const &data, TimePoint deadline)
+{
+    TRACE_SCOPE("baseline", "planner");
+    baselineSim_.load(data);
+    while (!baselineSim_.isOver())
+    {
+        if (stop_ || chrono::steady_clock::now() >= deadline)
+            return -1;
+        baselineSim_.getData(baselineData_);
+        baselineGame_.loadGameData(baselineData_);
+        baselineSim_.step(baselineGame_.playTurn());
+    }
+    return baselineSim_.getScore();
+}
@@ -0,0 +1,79 @@
+#include "Profiler.hpp"
+
+using namespace std;
+
+thread_local Profiler::Stats Profiler::stats;
+
+const char* Profiler::phaseName(Phase phase)
+{
+    static const char* names[phaseCount] = {
+        "loadGameData",
+        "chooseStrategy",
+        "doTheTriage",
+        "rateZombies",
+        "attackMostDenseZombie",
+        "searchDestination",
+        "planCleanup",
+        "writeSolution"
+    };
+    return names[phase];
+}
+
+const char* Profiler::counterName(Counter counter)
+{
+    static const char* names[counterCount] = {
+        "distanceEvaluations",
+        "zombiesScanned",
+        "humansScanned"
+    };
+    return names[counter];
+}
+
+void Profiler::record(Phase phase, uint64_t ns)
+{
+    PhaseStats &phaseStats = stats.phases_[phase];
+    int bucket = 0;
+    while (bucket < histogramBuckets - 1 && (ns >> bucket) > 1)
+    {
+        bucket++;
+    }
+    phaseStats.calls_++;
+    phaseStats.totalNs_ += ns;
+    phaseStats.maxNs_ = max(phaseStats.maxNs_, ns);
+    phaseStats.histogram_[bucket]++;
+}
+
+void Profiler::reset()
+{
+    stats = Stats();
+}
+
+void Profiler::report(ostream &out)
+{
+    out << "Profile (phase: calls, total us, avg ns, max ns):" << endl;
+    for (int p = 0; p < phaseCount; p++)
+    {
+        PhaseStats &phaseStats = stats.phases_[p];
+        if (phaseStats.calls_ == 0)
+            continue;
+        out << "  " << phaseName(Phase(p)) << ": " << phaseStats.calls_
+            << ", " << phaseStats.totalNs_/1000
+            << ", " << phaseStats.totalNs_/phaseStats.calls_
+            << ", " << phaseStats.maxNs_ << endl;
+        out << "   ";
+        for (int b = 0; b < histogramBuckets; b++)
+        {
+            if (phaseStats.histogram_[b] != 0)
+            {
+                out << " <" << (uint64_t(1) << (b + 1)) << "ns:"
+                    << phaseStats.histogram_[b];
+            }
+        }
+        out << endl;
+    }
+    for (int c = 0; c < counterCount; c++)
+    {
+        out << "  " << counterName(Counter(c)) << ": "
+            << stats.counters_[c] << endl;
+    }
+}
@@ -0,0 +1,295 @@
+#include "Replay.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+ReplayWriter::ReplayWriter(): pendingGame_(true), bytesWritten_(0)
+{}
+
+ReplayWriter::~ReplayWriter()
+{
+    close();
+}
+
+bool ReplayWriter::open(string const &path)
+{
+    close();
+    out_.open(path.c_str(),
+        std::ofstream::out | std::ofstream::binary | std::ofstream::app);
+    if (!out_)
+        return false;
+    out_.seekp(0, std::ios::end);
+    if (out_.tellp() == 0)
+    {
+        buffer_.insert(buffer_.end(), Replay::magic, Replay::magic + 4);
+        buffer_.push_back(Replay::version);
+        flush();
+    }
+    beginGame();
+    return true;
+}
+
+void ReplayWriter::close()
+{
+    if (out_.is_open())
+    {
+        flush();
+        out_.close();
+    }
+}
+
+void ReplayWriter::beginGame()
+{
+    pendingGame_ = true;
+    prevAsh_ = Position();
+    prevHumans_.clear();
+    prevZombies_.clear();
+}
+
+void ReplayWriter::writeTurn(GameData const &data, Position solution)
+{
+    if (pendingGame_)
+    {
+        buffer_.push_back(Replay::gameRecord);
+        pendingGame_ = false;
+    }
+    buffer_.push_back(Replay::turnRecord);
+    putSigned(data.ashPos_.x_ - prevAsh_.x_);
+    putSigned(data.ashPos_.y_ - prevAsh_.y_);
+    putSigned(solution.x_ - data.ashPos_.x_);
+    putSigned(solution.y_ - data.ashPos_.y_);
+
+    putUnsigned(data.humans_.size());
+    int lastId = -1;
+    auto prevHuman = prevHumans_.begin();
+    for (auto human: data.humans_)
+    {
+        while (prevHuman != prevHumans_.end() && prevHuman->id_ < human.id_)
+            ++prevHuman;
+        Position ref;
+        if (prevHuman != prevHumans_.end() && prevHuman->id_ == human.id_)
+            ref = prevHuman->pos_;
+        putUnsigned(human.id_ - lastId - 1);
+        putSigned(human.pos_.x_ - ref.x_);
+        putSigned(human.pos_.y_ - ref.y_);
+        lastId = human.id_;
+    }
+
+    putUnsigned(data.zombies_.size());
+    lastId = -1;
+    auto prevZombie = prevZombies_.begin();
+    for (auto zombie: data.zombies_)
+    {
+        while (prevZombie != prevZombies_.end() && prevZombie->id_ < zombie.id_)
+            ++prevZombie;
+        Position ref;
+        if (prevZombie != prevZombies_.end() && prevZombie->id_ == zombie.id_)
+            ref = prevZombie->nextPos_;
+        putUnsigned(zombie.id_ - lastId - 1);
+        putSigned(zombie.pos_.x_ - ref.x_);
+        putSigned(zombie.pos_.y_ - ref.y_);
+        putSigned(zombie.nextPos_.x_ - zombie.pos_.x_);
+        putSigned(zombie.nextPos_.y_ - zombie.pos_.y_);
+        lastId = zombie.id_;
+    }
+
+    prevAsh_ = data.ashPos_;
+    prevHumans_.assign(data.humans_.begin(), data.humans_.end());
+    prevZombies_.assign(data.zombies_.begin(), data.zombies_.end());
+    flush();
+}
+
+uint64_t ReplayWriter::getBytesWritten()
+{
+    return bytesWritten_ + buffer_.size();
+}
+
+void ReplayWriter::putUnsigned(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer_.push_back((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    buffer_.push_back(value);
+}
+
+void ReplayWriter::putSigned(int64_t value)
+{
+    putUnsigned((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void ReplayWriter::flush()
+{
+    out_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());
+    bytesWritten_ += buffer_.size();
+    buffer_.clear();
+}
+
+ReplayReader::ReplayReader():
+    fd_(-1), begin_(NULL), end_(NULL), pos_(NULL),
+    valid_(false), newGame_(false)
+{}
+
+ReplayReader::~ReplayReader()
+{
+    close();
+}
+
+bool ReplayReader::open(string const &path)
+{
+    close();
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd_, &st) != 0 || st.st_size < 5)
+    {
+        close();
+        return false;
+    }
+    void* mapped = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapped == MAP_FAILED)
+    {
+        close();
+        return false;
+    }
+    madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+    begin_ = static_cast<const unsigned char*>(mapped);
+    end_ = begin_ + st.st_size;
+    if (!equal(Replay::magic, Replay::magic + 4, begin_)
+        || begin_[4] != Replay::version)
+    {
+        close();
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+void ReplayReader::close()
+{
+    if (begin_ != NULL)
+    {
+        munmap(const_cast<unsigned char*>(begin_), end_ - begin_);
+    }
+    if (fd_ >= 0)
+    {
+        ::close(fd_);
+    }
+    fd_ = -1;
+    begin_ = end_ = pos_ = NULL;
+    valid_ = false;
+}
+
+void ReplayReader::rewind()
+{
+    pos_ = begin_ + 5;
+    valid_ = true;
+    newGame_ = false;
+    prevAsh_ = Position();
+    prevHumans_.clear();
+    prevZombies_.clear();
+}
+
+bool ReplayReader::next(GameData &data, Position &solution)
+{
+    newGame_ = false;
+    while (valid_ && pos_ < end_ && *pos_ == Replay::gameRecord)
+    {
+        pos_++;
+        newGame_ = true;
+        prevAsh_ = Position();
+        prevHumans_.clear();
+        prevZombies_.clear();
+    }
+    if (!valid_ || pos_ >= end_ || *pos_ != Replay::turnRecord)
+        return false;
+    pos_++;
+
+    data.ashPos_.x_ = prevAsh_.x_ + getSigned();
+    data.ashPos_.y_ = prevAsh_.y_ + getSigned();
+    solution.x_ = data.ashPos_.x_ + getSigned();
+    solution.y_ = data.ashPos_.y_ + getSigned();
+
+    data.humans_.clear();
+    data.humanCount_ = getUnsigned();
+    int lastId = -1;
+    auto prevHuman = prevHumans_.begin();
+    for (int i = 0; i < data.humanCount_ && valid_; i++)
+    {
+        Human human;
+        human.id_ = lastId + 1 + getUnsigned();
+        while (prevHuman != prevHumans_.end() && prevHuman->id_ < human.id_)
+            ++prevHuman;
+        if (prevHuman != prevHumans_.end() && prevHuman->id_ == human.id_)
+            human.pos_ = prevHuman->pos_;
+        human.pos_.x_ += getSigned();
+        human.pos_.y_ += getSigned();
+        data.humans_.insert(data.humans_.end(), human);
+        lastId = human.id_;
+    }
+
+    data.zombies_.clear();
+    data.zombieCount_ = getUnsigned();
+    lastId = -1;
+    auto prevZombie = prevZombies_.begin();
+    for (int i = 0; i < data.zombieCount_ && valid_; i++)
+    {
+        Zombie zombie;
+        zombie.id_ = lastId + 1 + getUnsigned();
+        while (prevZombie != prevZombies_.end() && prevZombie->id_ < zombie.id_)
+            ++prevZombie;
+        if (prevZombie != prevZombies_.end() && prevZombie->id_ == zombie.id_)
+            zombie.pos_ = prevZombie->nextPos_;
+        zombie.pos_.x_ += getSigned();
+        zombie.pos_.y_ += getSigned();
+        zombie.nextPos_.x_ = zombie.pos_.x_ + getSigned();
+        zombie.nextPos_.y_ = zombie.pos_.y_ + getSigned();
+        data.zombies_.insert(data.zombies_.end(), zombie);
+        lastId = zombie.id_;
+    }
+    if (!valid_)
+        return false;
+
+    prevAsh_ = data.ashPos_;
+    prevHumans_.assign(data.humans_.begin(), data.humans_.end());
+    prevZombies_.assign(data.zombies_.begin(), data.zombies_.end());
+    return true;
+}
+
+bool ReplayReader::isNewGame()
+{
+    return newGame_;
+}
+
+uint64_t ReplayReader::getSize()
+{
+    return end_ - begin_;
+}
+
+uint64_t ReplayReader::getUnsigned()
+{
+    uint64_t value = 0;
+    int shift = 0;
+    while (pos_ < end_ && shift < 64)
+    {
+        unsigned char byte = *pos_++;
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+        shift += 7;
+    }
+    valid_ = false;
+    return 0;
+}
+
+int64_t ReplayReader::getSigned()
+{
+    uint64_t value = getUnsigned();
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
@@ -0,0 +1,225 @@
+#include "Rescue.hpp"
+
+using namespace std;
+
+namespace
+{
+const int unreachable = 1 << 29;
+const signed char noParent = -1;
+
+int popcount(unsigned mask)
+{
+    int count = 0;
+    for (; mask; mask &= mask - 1)
+    {
+        count++;
+    }
+    return count;
+}
+}
+
+const int RescueTarget::noIntercept;
+const int RescueScheduler::exactLimit;
+
+RescueScheduler::RescueScheduler()
+{
+    cover_.reserve(exactLimit*exactLimit);
+    walk_.reserve(exactLimit*exactLimit);
+    best_.reserve((1u << exactLimit)*exactLimit);
+    parent_.reserve((1u << exactLimit)*exactLimit);
+    route_.reserve(Helpers::maxHumans);
+    candidate_.reserve(Helpers::maxHumans);
+    plan_.order_.reserve(Helpers::maxHumans);
+    plan_.waypoints_.reserve(Helpers::maxHumans);
+}
+
+RescuePlan const &RescueScheduler::schedule(Position ash,
+    vector<RescueTarget> const &targets)
+{
+    if (int(targets.size()) <= exactLimit)
+        return scheduleExact(ash, targets);
+    return scheduleGreedy(ash, targets);
+}
+
+RescuePlan const &RescueScheduler::scheduleExact(Position ash,
+    vector<RescueTarget> const &targets)
+{
+    int n = targets.size();
+    plan_.order_.clear();
+    plan_.waypoints_.clear();
+    plan_.saved_ = 0;
+    plan_.turns_ = 0;
+    if (n == 0)
+        return plan_;
+
+    cover_.resize(n*n);
+    walk_.resize(n*n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            cover_[i*n + j] = coverTurns(targets[i].pos_, targets[j].pos_);
+            walk_[i*n + j] = walkTurns(targets[i].pos_, targets[j].pos_);
+        }
+    }
+    unsigned masks = 1u << n;
+    best_.assign(masks*n, unreachable);
+    parent_.resize(masks*n);
+    for (int j = 0; j < n; j++)
+    {
+        int arrival = unreachable;
+        if (coverTurns(ash, targets[j].pos_) < targets[j].deadline_)
+            arrival = walkTurns(ash, targets[j].pos_);
+        else if (intercepts(ash, targets[j]))
+            arrival = targets[j].intercept_.turns_;
+        best_[(1u << j)*n + j] = arrival;
+        parent_[(1u << j)*n + j] = noParent;
+    }
+
+    int bestSaved = 0;
+    int bestTurns = 0;
+    int bestState = -1;
+    for (unsigned mask = 1; mask < masks; mask++)
+    {
+        for (int last = 0; last < n; last++)
+        {
+            int time = best_[mask*n + last];
+            if (time == unreachable)
+                continue;
+            int saved = popcount(mask);
+            if (saved > bestSaved || (saved == bestSaved && time < bestTurns))
+            {
+                bestSaved = saved;
+                bestTurns = time;
+                bestState = mask*n + last;
+            }
+            for (int next = 0; next < n; next++)
+            {
+                if (mask & (1u << next))
+                    continue;
+                if (time + cover_[last*n + next] >= targets[next].deadline_)
+                    continue;
+                int state = (mask | (1u << next))*n + next;
+                int arrival = time + walk_[last*n + next];
+                if (arrival < best_[state])
+                {
+                    best_[state] = arrival;
+                    parent_[state] = last;
+                }
+            }
+        }
+    }
+
+    route_.clear();
+    for (int state = bestState; state >= 0;)
+    {
+        int last = state % n;
+        route_.push_back(last);
+        unsigned mask = state/n & ~(1u << last);
+        state = parent_[state] == noParent ? -1 : mask*n + parent_[state];
+    }
+    for (int i = route_.size() - 1; i >= 0; i--)
+    {
+        RescueTarget const &target = targets[route_[i]];
+        bool first = i == int(route_.size()) - 1;
+        addStop(target.humanId_, first && intercepts(ash, target)
+            ? target.intercept_.point_ : target.pos_);
+    }
+    plan_.saved_ = bestSaved;
+    plan_.turns_ = bestTurns;
+    return plan_;
+}
+
+RescuePlan const &RescueScheduler::scheduleGreedy(Position ash,
+    vector<RescueTarget> const &targets)
+{
+    int n = targets.size();
+    route_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        route_[i] = i;
+    }
+    sort(route_.begin(), route_.end(), [&targets](int a, int b)
+    {
+        return targets[a].deadline_ < targets[b].deadline_;
+    });
+
+    int bestTurns = 0;
+    int bestSaved = walkRoute(ash, targets, route_, bestTurns, false);
+    bool improved = true;
+    while (improved)
+    {
+        improved = false;
+        for (int i = 0; i + 1 < n; i++)
+        {
+            for (int k = i + 1; k < n; k++)
+            {
+                candidate_ = route_;
+                reverse(candidate_.begin() + i, candidate_.begin() + k + 1);
+                int turns = 0;
+                int saved = walkRoute(ash, targets, candidate_, turns, false);
+                if (saved > bestSaved
+                    || (saved == bestSaved && turns < bestTurns))
+                {
+                    route_.swap(candidate_);
+                    bestSaved = saved;
+                    bestTurns = turns;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    plan_.order_.clear();
+    plan_.waypoints_.clear();
+    plan_.saved_ = walkRoute(ash, targets, route_, plan_.turns_, true);
+    return plan_;
+}
+
+int RescueScheduler::coverTurns(Position from, Position to)
+{
+    double dist = Helpers::distance(from, to) - Helpers::shootingRadius;
+    return dist <= 0 ? 0 : ceil(dist/Helpers::ashStepSize);
+}
+
+int RescueScheduler::walkTurns(Position from, Position to)
+{
+    return ceil(Helpers::distance(from, to)/Helpers::ashStepSize);
+}
+
+bool RescueScheduler::intercepts(Position ash, RescueTarget const &target)
+{
+    return coverTurns(ash, target.pos_) >= target.deadline_
+        && target.intercept_.turns_ < target.deadline_;
+}
+
+int RescueScheduler::walkRoute(Position ash,
+    vector<RescueTarget> const &targets, vector<int> const &order,
+    int &turns, bool record)
+{
+    int saved = 0;
+    turns = 0;
+    Position pos = ash;
+    for (auto index: order)
+    {
+        RescueTarget const &target = targets[index];
+        bool intercepted = saved == 0 && intercepts(ash, target);
+        if (!intercepted
+            && turns + coverTurns(pos, target.pos_) >= target.deadline_)
+            continue;
+        turns = intercepted ? target.intercept_.turns_
+            : turns + walkTurns(pos, target.pos_);
+        pos = target.pos_;
+        saved++;
+        if (record)
+            addStop(target.humanId_,
+                intercepted ? target.intercept_.point_ : target.pos_);
+    }
+    return saved;
+}
+
+void RescueScheduler::addStop(int humanId, Position waypoint)
+{
+    plan_.order_.push_back(humanId);
+    plan_.waypoints_.push_back(waypoint);
+}
@@ -0,0 +1,241 @@
+#include "Endgame.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+int Rules::comboMultiplier(int killIndex)
+{
+    int prev = 1;
+    int curr = 1;
+    for (int i = 1; i < killIndex; i++)
+    {
+        int next = prev + curr;
+        prev = curr;
+        curr = next;
+    }
+    return curr;
+}
+
+int Rules::killScore(int humansAlive, int killIndex)
+{
+    return 10*humansAlive*humansAlive*comboMultiplier(killIndex);
+}
+
+Position Rules::move(Position from, Position to, int stepSize)
+{
+    return Helpers::move(from, to, stepSize);
+}
+
+Simulator::Simulator(): score_(0), turn_(0)
+{}
+
+Simulator::Simulator(GameData const &data): Simulator()
+{
+    load(data);
+}
+
+void Simulator::load(GameData const &data)
+{
+    ashPos_ = data.ashPos_;
+    humans_.assign(data.humans_.begin(), data.humans_.end());
+    zombies_.assign(data.zombies_.begin(), data.zombies_.end());
+    score_ = 0;
+    turn_ = 0;
+}
+
+void Simulator::reserve(int humans, int zombies)
+{
+    humans_.reserve(humans);
+    zombies_.reserve(zombies);
+}
+
+void Simulator::step(Position target)
+{
+    for (auto &zombie: zombies_)
+    {
+        zombie.pos_ = Rules::move(zombie.pos_,
+            findTarget(zombie.pos_), Helpers::zombieStepSize);
+    }
+    target.x_ = min(max(target.x_, 0), Rules::mapWidth - 1);
+    target.y_ = min(max(target.y_, 0), Rules::mapHeight - 1);
+    ashPos_ = Rules::move(ashPos_, target, Helpers::ashStepSize);
+
+    int humansAlive = humans_.size();
+    int killIndex = 0;
+    double rangeSqr = double(Helpers::shootingRadius)*Helpers::shootingRadius;
+    for (auto it = zombies_.begin(); it != zombies_.end();)
+    {
+        double dx = it->pos_.x_ - ashPos_.x_;
+        double dy = it->pos_.y_ - ashPos_.y_;
+        if (dx*dx + dy*dy <= rangeSqr)
+        {
+            killIndex++;
+            score_ += Rules::killScore(humansAlive, killIndex);
+            it = zombies_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto zombie: zombies_)
+    {
+        for (auto it = humans_.begin(); it != humans_.end();)
+        {
+            if (it->pos_.x_ == zombie.pos_.x_ && it->pos_.y_ == zombie.pos_.y_)
+            {
+                it = humans_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    if (humans_.empty())
+    {
+        score_ = 0;
+    }
+    turn_++;
+}
+
+bool Simulator::isOver()
+{
+    return zombies_.empty() || humans_.empty() || turn_ >= Rules::maxTurns;
+}
+
+int Simulator::getScore()
+{
+    return score_;
+}
+
+int Simulator::getTurn()
+{
+    return turn_;
+}
+
+int Simulator::getHumansAlive()
+{
+    return humans_.size();
+}
+
+int Simulator::getZombiesAlive()
+{
+    return zombies_.size();
+}
+
+Position Simulator::getAshPos()
+{
+    return ashPos_;
+}
+
+Zombie Simulator::getZombie(int index)
+{
+    Zombie zombie = zombies_[index];
+    zombie.nextPos_ = Rules::move(zombie.pos_, findTarget(zombie.pos_),
+        Helpers::zombieStepSize);
+    return zombie;
+}
+
+Position Simulator::nearestZombie()
+{
+    Position nearest = ashPos_;
+    double minDist = -1;
+    for (auto zombie: zombies_)
+    {
+        double dist = Helpers::distance(ashPos_, zombie.pos_);
+        if (minDist < 0 || dist < minDist)
+        {
+            minDist = dist;
+            nearest = zombie.pos_;
+        }
+    }
+    return nearest;
+}
+
+GameData Simulator::getData()
+{
+    GameData data;
+    getData(data);
+    return data;
+}
+
+// Fills data in place so a caller that keeps the buffer reuses its storage.
+void Simulator::getData(GameData &data)
+{
+    data.ashPos_ = ashPos_;
+    data.humanCount_ = humans_.size();
+    data.humans_.clear();
+    data.humans_.insert(humans_.begin(), humans_.end());
+    data.zombieCount_ = zombies_.size();
+    data.zombies_.clear();
+    for (auto zombie: zombies_)
+    {
+        zombie.nextPos_ = Rules::move(zombie.pos_,
+            findTarget(zombie.pos_), Helpers::zombieStepSize);
+        data.zombies_.insert(zombie);
+    }
+}
+
+GameData Simulator::loadScenario(string const &path)
+{
+    GameController game;
+    ifstream ifs(path.c_str(), std::ifstream::in);
+    game.loadGameData(ifs);
+    return game.getData();
+}
+
+GameData Simulator::randomScenario(int humans, int zombies, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> randomX(0, Rules::mapWidth - 1);
+    uniform_int_distribution<int> randomY(0, Rules::mapHeight - 1);
+    GameData data;
+    data.ashPos_ = Position(randomX(rng), randomY(rng));
+    for (int i = 0; i < humans; i++)
+    {
+        data.humans_.insert(Human(i, Position(randomX(rng), randomY(rng))));
+    }
+    for (int i = 0; i < zombies; i++)
+    {
+        data.zombies_.insert(Zombie(i,
+            Position(randomX(rng), randomY(rng)), Position()));
+    }
+    data.humanCount_ = humans;
+    data.zombieCount_ = zombies;
+    Simulator sim(data);
+    return sim.getData();
+}
+
+int Simulator::playGame(GameData const &scenario, StrategyParams params)
+{
+    GameController game;
+    game.setVerbose(false);
+    game.setParams(params);
+    EndgameSolver endgame;
+    game.setAdvisor(&endgame);
+    Simulator sim(scenario);
+    while (!sim.isOver())
+    {
+        game.loadGameData(sim.getData());
+        sim.step(game.playTurn());
+    }
+    return sim.getScore();
+}
+
+Position Simulator::findTarget(Position zombiePos)
+{
+    Position target = ashPos_;
+    double minDist = Helpers::distance(zombiePos, ashPos_);
+    for (auto human: humans_)
+    {
+        double dist = Helpers::distance(zombiePos, human.pos_);
+        if (dist < minDist)
+        {
+            minDist = dist;
+            target = human.pos_;
+        }
+    }
+    return target;
+}
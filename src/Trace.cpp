@@ -0,0 +1,156 @@
+#include "Trace.hpp"
+
+#include <cstdlib>
+
+using namespace std;
+
+namespace
+{
+struct ThreadBuffer
+{
+    int tid_;
+    string name_;
+    vector<Trace::Event> events_;
+};
+
+mutex registryMutex;
+vector<unique_ptr<ThreadBuffer> > registry;
+string outputPath;
+Trace::TimePoint origin;
+bool exitHandlerInstalled = false;
+thread_local ThreadBuffer* threadBuffer = NULL;
+
+ThreadBuffer &buffer()
+{
+    if (threadBuffer == NULL)
+    {
+        lock_guard<mutex> lock(registryMutex);
+        registry.push_back(unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+        threadBuffer = registry.back().get();
+        threadBuffer->tid_ = registry.size();
+        threadBuffer->events_.reserve(1 << 14);
+    }
+    return *threadBuffer;
+}
+
+int64_t sinceOrigin(Trace::TimePoint time)
+{
+    return chrono::duration_cast<chrono::nanoseconds>(time - origin).count();
+}
+
+void push(const char* name, const char* category, char phase,
+    int64_t ts, int64_t dur, int64_t value)
+{
+    Trace::Event event = {name, category, phase, ts, dur, value};
+    buffer().events_.push_back(event);
+}
+
+void writeTime(ofstream &out, int64_t ns)
+{
+    out << ns/1000 << "." << char('0' + ns/100 % 10)
+        << char('0' + ns/10 % 10) << char('0' + ns % 10);
+}
+}
+
+atomic<bool> Trace::enabled(false);
+
+bool Trace::start(string const &path)
+{
+    lock_guard<mutex> lock(registryMutex);
+    outputPath = path;
+    origin = chrono::steady_clock::now();
+    for (auto &threadBuf: registry)
+    {
+        threadBuf->events_.clear();
+    }
+    if (!exitHandlerInstalled)
+    {
+        atexit(stop);
+        exitHandlerInstalled = true;
+    }
+    enabled.store(true, memory_order_relaxed);
+    return true;
+}
+
+bool Trace::startFromEnv()
+{
+    const char* path = getenv("CVZ_TRACE");
+    if (path == NULL || *path == 0)
+        return false;
+    return start(path);
+}
+
+void Trace::stop()
+{
+    if (!enabled.exchange(false))
+        return;
+    lock_guard<mutex> lock(registryMutex);
+    ofstream out(outputPath.c_str(), std::ofstream::out);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << endl;
+    bool first = true;
+    for (auto &threadBuf: registry)
+    {
+        if (!threadBuf->name_.empty())
+        {
+            out << (first ? "" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                << threadBuf->tid_ << ",\"args\":{\"name\":\""
+                << threadBuf->name_ << "\"}}";
+            first = false;
+        }
+        for (auto &event: threadBuf->events_)
+        {
+            out << (first ? "" : ",\n")
+                << "{\"name\":\"" << event.name_
+                << "\",\"cat\":\"" << event.category_
+                << "\",\"ph\":\"" << event.phase_
+                << "\",\"pid\":1,\"tid\":" << threadBuf->tid_ << ",\"ts\":";
+            writeTime(out, event.ts_);
+            if (event.phase_ == 'X')
+            {
+                out << ",\"dur\":";
+                writeTime(out, event.dur_);
+            }
+            else if (event.phase_ == 'C')
+            {
+                out << ",\"args\":{\"value\":" << event.value_ << "}";
+            }
+            else if (event.phase_ == 'i')
+            {
+                out << ",\"s\":\"t\"";
+            }
+            out << "}";
+            first = false;
+        }
+        threadBuf->events_.clear();
+    }
+    out << endl << "]}" << endl;
+}
+
+void Trace::setThreadName(string const &name)
+{
+    if (isEnabled())
+        buffer().name_ = name;
+}
+
+void Trace::complete(const char* name, const char* category,
+    TimePoint begin, TimePoint end)
+{
+    if (isEnabled())
+        push(name, category, 'X', sinceOrigin(begin),
+            sinceOrigin(end) - sinceOrigin(begin), 0);
+}
+
+void Trace::instant(const char* name, const char* category)
+{
+    if (isEnabled())
+        push(name, category, 'i',
+            sinceOrigin(chrono::steady_clock::now()), 0, 0);
+}
+
+void Trace::counter(const char* name, int64_t value)
+{
+    if (isEnabled())
+        push(name, "counter", 'C',
+            sinceOrigin(chrono::steady_clock::now()), 0, value);
+}
@@ -0,0 +1,178 @@
+#include "Trajectory.hpp"
+
+using namespace std;
+
+namespace
+{
+long long distSqr(Position p1, Position p2)
+{
+    long long x = p2.x_ - p1.x_;
+    long long y = p2.y_ - p1.y_;
+    return x*x + y*y;
+}
+
+bool samePosition(Position p1, Position p2)
+{
+    return p1.x_ == p2.x_ && p1.y_ == p2.y_;
+}
+}
+
+const int TrajectoryCache::ashTarget;
+
+TrajectoryCache::Entry::Entry():
+    alive_(false), seen_(false), targetId_(ashTarget), offset_(0)
+{}
+
+TrajectoryCache::TrajectoryCache(int horizon):
+    horizon_(horizon), recomputed_(0)
+{
+    // Paths are reserved up front: a zombie first met in the middle of a
+    // game would otherwise allocate its path on the turn it is tracked.
+    entries_.resize(Helpers::maxZombies);
+    for (auto &entry: entries_)
+    {
+        entry.path_.reserve(2*horizon_ + 2);
+    }
+}
+
+void TrajectoryCache::update(GameData const &data)
+{
+    recomputed_ = 0;
+    for (auto &entry: entries_)
+    {
+        entry.seen_ = false;
+    }
+    for (auto zombie: data.zombies_)
+    {
+        if (zombie.id_ >= int(entries_.size()))
+            entries_.resize(zombie.id_ + 1);
+        Entry &entry = entries_[zombie.id_];
+        if (!stillValid(entry, zombie, data))
+            recompute(entry, zombie, data);
+        entry.seen_ = true;
+    }
+    for (auto &entry: entries_)
+    {
+        entry.alive_ = entry.alive_ && entry.seen_;
+    }
+    ashPos_ = data.ashPos_;
+}
+
+void TrajectoryCache::clear()
+{
+    for (auto &entry: entries_)
+    {
+        entry.alive_ = false;
+    }
+}
+
+Position TrajectoryCache::positionAt(int zombieId, int turn)
+{
+    if (!isTracked(zombieId))
+        return Position();
+    Entry &entry = entries_[zombieId];
+    extend(entry, turn);
+    int index = min<int>(entry.offset_ + turn, entry.path_.size() - 1);
+    return entry.path_[index];
+}
+
+int TrajectoryCache::turnsToTarget(int zombieId)
+{
+    if (!isTracked(zombieId))
+        return -1;
+    Entry &entry = entries_[zombieId];
+    while (!samePosition(entry.path_.back(), entry.target_))
+    {
+        extend(entry, entry.path_.size() - entry.offset_);
+    }
+    return entry.path_.size() - 1 - entry.offset_;
+}
+
+int TrajectoryCache::getTargetId(int zombieId)
+{
+    return isTracked(zombieId) ? entries_[zombieId].targetId_ : ashTarget;
+}
+
+Position TrajectoryCache::getTarget(int zombieId)
+{
+    return isTracked(zombieId) ? entries_[zombieId].target_ : ashPos_;
+}
+
+bool TrajectoryCache::isTracked(int zombieId)
+{
+    return zombieId >= 0 && zombieId < int(entries_.size())
+        && entries_[zombieId].alive_;
+}
+
+int TrajectoryCache::getHorizon()
+{
+    return horizon_;
+}
+
+int TrajectoryCache::getRecomputed()
+{
+    return recomputed_;
+}
+
+bool TrajectoryCache::stillValid(Entry &entry, Zombie const &zombie,
+    GameData const &data)
+{
+    if (!entry.alive_)
+        return false;
+    entry.offset_++;
+    // Dropping the walked part keeps the path within the capacity
+    // recompute() reserved.
+    if (entry.offset_ >= horizon_)
+    {
+        int walked = min<int>(entry.offset_, entry.path_.size() - 1);
+        entry.path_.erase(entry.path_.begin(), entry.path_.begin() + walked);
+        entry.offset_ -= walked;
+    }
+    extend(entry, 1);
+    int last = entry.path_.size() - 1;
+    if (!samePosition(entry.path_[min(entry.offset_, last)], zombie.pos_)
+        || !samePosition(entry.path_[min(entry.offset_ + 1, last)],
+            zombie.nextPos_))
+        return false;
+    if (entry.targetId_ == ashTarget)
+        return samePosition(ashPos_, data.ashPos_);
+    if (data.humans_.count(Human(entry.targetId_, Position())) == 0)
+        return false;
+    return distSqr(zombie.pos_, entry.target_)
+        < distSqr(zombie.pos_, data.ashPos_);
+}
+
+void TrajectoryCache::recompute(Entry &entry, Zombie const &zombie,
+    GameData const &data)
+{
+    recomputed_++;
+    entry.alive_ = true;
+    entry.offset_ = 0;
+    entry.targetId_ = ashTarget;
+    entry.target_ = data.ashPos_;
+    long long minDist = distSqr(zombie.pos_, data.ashPos_);
+    for (auto human: data.humans_)
+    {
+        long long dist = distSqr(zombie.pos_, human.pos_);
+        if (dist < minDist)
+        {
+            minDist = dist;
+            entry.targetId_ = human.id_;
+            entry.target_ = human.pos_;
+        }
+    }
+    entry.path_.clear();
+    entry.path_.reserve(2*horizon_ + 2);
+    entry.path_.push_back(zombie.pos_);
+    extend(entry, horizon_);
+}
+
+void TrajectoryCache::extend(Entry &entry, int turns)
+{
+    while (int(entry.path_.size()) <= entry.offset_ + turns
+        && !samePosition(entry.path_.back(), entry.target_))
+    {
+        entry.path_.push_back(Helpers::move(entry.path_.back(),
+            entry.target_, Helpers::zombieStepSize));
+    }
+}
@@ -0,0 +1,317 @@
+#include "Tuner.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace std;
+
+CmaEs::CmaEs(vector<double> const &mean, double sigma,
+    int lambda, unsigned seed):
+    n_(mean.size()), generation_(0), mean_(mean), sigma_(sigma),
+    rng_(seed)
+{
+    lambda_ = max(lambda, 4 + int(3*log(double(n_))));
+    mu_ = lambda_/2;
+    double weightSum = 0;
+    for (int i = 0; i < mu_; i++)
+    {
+        weights_.push_back(log(mu_ + 0.5) - log(i + 1.0));
+        weightSum += weights_.back();
+    }
+    double weightSqrSum = 0;
+    for (auto &w: weights_)
+    {
+        w /= weightSum;
+        weightSqrSum += w*w;
+    }
+    mueff_ = 1.0/weightSqrSum;
+    cc_ = (4.0 + mueff_/n_)/(n_ + 4.0 + 2.0*mueff_/n_);
+    cs_ = (mueff_ + 2.0)/(n_ + mueff_ + 5.0);
+    c1_ = 2.0/((n_ + 1.3)*(n_ + 1.3) + mueff_);
+    cmu_ = min(1.0 - c1_,
+        2.0*(mueff_ - 2.0 + 1.0/mueff_)/((n_ + 2.0)*(n_ + 2.0) + mueff_));
+    damps_ = 1.0 + 2.0*max(0.0, sqrt((mueff_ - 1.0)/(n_ + 1.0)) - 1.0) + cs_;
+    chiN_ = sqrt(double(n_))*(1.0 - 1.0/(4.0*n_) + 1.0/(21.0*n_*n_));
+    pc_.assign(n_, 0.0);
+    ps_.assign(n_, 0.0);
+    C_.assign(n_, vector<double>(n_, 0.0));
+    B_.assign(n_, vector<double>(n_, 0.0));
+    D_.assign(n_, 1.0);
+    for (int i = 0; i < n_; i++)
+    {
+        C_[i][i] = 1.0;
+        B_[i][i] = 1.0;
+    }
+}
+
+vector<vector<double> > CmaEs::ask()
+{
+    normal_distribution<double> normal(0.0, 1.0);
+    vector<vector<double> > candidates(lambda_, mean_);
+    vector<double> z(n_);
+    for (auto &candidate: candidates)
+    {
+        for (int i = 0; i < n_; i++)
+        {
+            z[i] = D_[i]*normal(rng_);
+        }
+        for (int i = 0; i < n_; i++)
+        {
+            double y = 0;
+            for (int j = 0; j < n_; j++)
+            {
+                y += B_[i][j]*z[j];
+            }
+            candidate[i] += sigma_*y;
+        }
+    }
+    return candidates;
+}
+
+void CmaEs::tell(vector<vector<double> > const &candidates,
+    vector<double> const &costs)
+{
+    vector<int> order(candidates.size());
+    for (unsigned i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    sort(order.begin(), order.end(),
+        [&costs](int a, int b) { return costs[a] < costs[b]; });
+
+    vector<double> oldMean = mean_;
+    for (int i = 0; i < n_; i++)
+    {
+        mean_[i] = 0;
+        for (int k = 0; k < mu_; k++)
+        {
+            mean_[i] += weights_[k]*candidates[order[k]][i];
+        }
+    }
+    vector<double> step(n_);
+    for (int i = 0; i < n_; i++)
+    {
+        step[i] = (mean_[i] - oldMean[i])/sigma_;
+    }
+
+    // ps uses C^(-1/2) * step = B * D^-1 * B^T * step
+    vector<double> tmp(n_, 0.0);
+    for (int i = 0; i < n_; i++)
+    {
+        for (int j = 0; j < n_; j++)
+        {
+            tmp[i] += B_[j][i]*step[j];
+        }
+        tmp[i] /= D_[i];
+    }
+    double psNorm = 0;
+    for (int i = 0; i < n_; i++)
+    {
+        double invSqrtStep = 0;
+        for (int j = 0; j < n_; j++)
+        {
+            invSqrtStep += B_[i][j]*tmp[j];
+        }
+        ps_[i] = (1.0 - cs_)*ps_[i]
+            + sqrt(cs_*(2.0 - cs_)*mueff_)*invSqrtStep;
+        psNorm += ps_[i]*ps_[i];
+    }
+    psNorm = sqrt(psNorm);
+    generation_++;
+    bool hsig = psNorm/sqrt(1.0 - pow(1.0 - cs_, 2.0*generation_))/chiN_
+        < 1.4 + 2.0/(n_ + 1.0);
+    for (int i = 0; i < n_; i++)
+    {
+        pc_[i] = (1.0 - cc_)*pc_[i]
+            + (hsig ? sqrt(cc_*(2.0 - cc_)*mueff_)*step[i] : 0.0);
+    }
+
+    double hsigCorrection = hsig ? 0.0 : cc_*(2.0 - cc_);
+    for (int i = 0; i < n_; i++)
+    {
+        for (int j = 0; j <= i; j++)
+        {
+            double rankMu = 0;
+            for (int k = 0; k < mu_; k++)
+            {
+                vector<double> const &x = candidates[order[k]];
+                rankMu += weights_[k]
+                    *(x[i] - oldMean[i])*(x[j] - oldMean[j])
+                    /(sigma_*sigma_);
+            }
+            C_[i][j] = (1.0 - c1_ - cmu_)*C_[i][j]
+                + c1_*(pc_[i]*pc_[j] + hsigCorrection*C_[i][j])
+                + cmu_*rankMu;
+            C_[j][i] = C_[i][j];
+        }
+    }
+    sigma_ *= exp((cs_/damps_)*(psNorm/chiN_ - 1.0));
+    decompose();
+}
+
+vector<double> CmaEs::getMean()
+{
+    return mean_;
+}
+
+double CmaEs::getSigma()
+{
+    return sigma_;
+}
+
+int CmaEs::getLambda()
+{
+    return lambda_;
+}
+
+void CmaEs::decompose()
+{
+    // cyclic Jacobi rotations, C = B * diag(D^2) * B^T
+    vector<vector<double> > a = C_;
+    for (int i = 0; i < n_; i++)
+    {
+        for (int j = 0; j < n_; j++)
+        {
+            B_[i][j] = (i == j) ? 1.0 : 0.0;
+        }
+    }
+    for (int sweep = 0; sweep < 50; sweep++)
+    {
+        double offDiag = 0;
+        for (int p = 0; p < n_; p++)
+        {
+            for (int q = p + 1; q < n_; q++)
+            {
+                offDiag += a[p][q]*a[p][q];
+            }
+        }
+        if (offDiag < 1e-30)
+            break;
+        for (int p = 0; p < n_; p++)
+        {
+            for (int q = p + 1; q < n_; q++)
+            {
+                if (fabs(a[p][q]) < 1e-300)
+                    continue;
+                double theta = (a[q][q] - a[p][p])/(2.0*a[p][q]);
+                double t = (theta >= 0 ? 1.0 : -1.0)
+                    /(fabs(theta) + sqrt(theta*theta + 1.0));
+                double c = 1.0/sqrt(t*t + 1.0);
+                double s = t*c;
+                for (int k = 0; k < n_; k++)
+                {
+                    double akp = a[k][p];
+                    double akq = a[k][q];
+                    a[k][p] = c*akp - s*akq;
+                    a[k][q] = s*akp + c*akq;
+                }
+                for (int k = 0; k < n_; k++)
+                {
+                    double apk = a[p][k];
+                    double aqk = a[q][k];
+                    a[p][k] = c*apk - s*aqk;
+                    a[q][k] = s*apk + c*aqk;
+                }
+                for (int k = 0; k < n_; k++)
+                {
+                    double bkp = B_[k][p];
+                    double bkq = B_[k][q];
+                    B_[k][p] = c*bkp - s*bkq;
+                    B_[k][q] = s*bkp + c*bkq;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < n_; i++)
+    {
+        D_[i] = sqrt(max(a[i][i], 1e-20));
+    }
+}
+
+vector<double> Tuner::encode(StrategyParams const &params)
+{
+    vector<double> x;
+    x.push_back(log(params.zombieFactor_));
+    x.push_back(log(params.humanFactor_));
+    x.push_back(log(params.endangeredFactor_));
+    x.push_back(log(params.ashFactor_));
+    x.push_back(params.neighbourhoodRadius_/1000.0);
+    x.push_back(params.endangeredSteps_);
+    return x;
+}
+
+StrategyParams Tuner::decode(vector<double> const &x)
+{
+    StrategyParams params;
+    params.zombieFactor_ = exp(min(max(x[0], -10.0), 10.0));
+    params.humanFactor_ = exp(min(max(x[1], -10.0), 10.0));
+    params.endangeredFactor_ = exp(min(max(x[2], -10.0), 10.0));
+    params.ashFactor_ = exp(min(max(x[3], -10.0), 10.0));
+    params.neighbourhoodRadius_ = 1000.0*min(max(x[4], 0.0), 10.0);
+    params.endangeredSteps_ = int(floor(min(max(x[5], 0.0), 10.0) + 0.5));
+    return params;
+}
+
+vector<double> Tuner::evaluate(vector<StrategyParams> const &candidates,
+    vector<GameData> const &corpus, unsigned threads)
+{
+    size_t jobs = candidates.size()*corpus.size();
+    vector<int> scores(jobs, 0);
+    atomic<size_t> nextJob(0);
+    auto worker = [&](unsigned index)
+    {
+        Trace::setThreadName("tuner worker " + to_string(index));
+        size_t job;
+        while ((job = nextJob++) < jobs)
+        {
+            TRACE_SCOPE("playGame", "tuner");
+            scores[job] = Simulator::playGame(
+                corpus[job % corpus.size()],
+                candidates[job/corpus.size()]);
+        }
+    };
+    vector<thread> workers;
+    for (unsigned i = 1; i < max(threads, 1u); i++)
+    {
+        workers.push_back(thread(worker, i));
+    }
+    worker(0);
+    for (auto &w: workers)
+    {
+        w.join();
+    }
+
+    vector<double> meanScores(candidates.size(), 0.0);
+    for (size_t job = 0; job < jobs; job++)
+    {
+        meanScores[job/corpus.size()] += scores[job];
+    }
+    for (auto &score: meanScores)
+    {
+        score /= max(corpus.size(), size_t(1));
+    }
+    return meanScores;
+}
+
+void Tuner::writeHeader(ostream &out, StrategyParams const &params)
+{
+    out.precision(17);
+    out << "// Generated by tools/tuner - do not edit by hand." << endl
+        << "#ifndef TUNEDPARAMS_HPP" << endl
+        << "#define TUNEDPARAMS_HPP" << endl
+        << endl
+        << "namespace Helpers" << endl
+        << "{" << endl
+        << "const double zombieFactor = " << params.zombieFactor_ << ";" << endl
+        << "const double humanFactor = " << params.humanFactor_ << ";" << endl
+        << "const double endangeredFactor = "
+        << params.endangeredFactor_ << ";" << endl
+        << "const double ashFactor = " << params.ashFactor_ << ";" << endl
+        << "const double neighbourhoodRadius = "
+        << params.neighbourhoodRadius_ << ";" << endl
+        << "const int endangeredSteps = "
+        << params.endangeredSteps_ << ";" << endl
+        << "}" << endl
+        << endl
+        << "#endif" << endl;
+}
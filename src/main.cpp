@@ -1,7 +1,23 @@
-#include "GameController.hpp"
+#include "Divergence.hpp"
+#include "Endgame.hpp"
+#include "Ponder.hpp"
 
 int main()
 {
-    GameController game;
-    game.startGame();
-}
\ No newline at end of file
+    Trace::startFromEnv();
+    Trace::setThreadName("main");
+    {
+        GameController game;
+        DivergenceMonitor monitor(&std::cerr);
+        game.setListener(&monitor);
+        EndgameSolver endgame;
+        game.setAdvisor(&endgame);
+        PonderingPlanner ponderer;
+        game.setPonderer(&ponderer);
+        game.startGame();
+        monitor.report(std::cerr);
+        ponderer.report(std::cerr);
+    }
+    // The ponder worker is joined by now, so no thread is still recording.
+    Trace::stop();
+}
@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <sstream>
+
+#include "AllocCounter.hpp"
+#include "Divergence.hpp"
+#include "Endgame.hpp"
+#include "GameController.hpp"
+#include "Ponder.hpp"
+
+using namespace std;
+
+
+class NullBuffer: public streambuf
+{
+protected:
+    int overflow(int c)
+    {
+        return c;
+    }
+};
+
+TEST(AllocCounterTest, shouldCountAllocationsAndBytes)
+{
+    AllocCounter::reset();
+
+    vector<int>* numbers = new vector<int>(100);
+    delete numbers;
+
+    ASSERT_EQ(2, AllocCounter::allocations());
+    ASSERT_EQ(sizeof(vector<int>) + 100*sizeof(int), AllocCounter::bytes());
+}
+
+TEST(AllocCounterTest, warmedUpTurnShouldNotAllocate)
+{
+    ifstream ifs("data/manyZombies.dat", std::ifstream::in);
+    stringstream bigTurn;
+    bigTurn << ifs.rdbuf();
+    ifs.close();
+    ifs.open("data/sampleRoundData.dat", std::ifstream::in);
+    stringstream smallTurn;
+    smallTurn << ifs.rdbuf();
+    NullBuffer nullBuffer;
+    streambuf* coutBuf = cout.rdbuf(&nullBuffer);
+    streambuf* cerrBuf = cerr.rdbuf(&nullBuffer);
+    GameController game;
+    game.setVerbose(true);
+    bool played = game.runTurn(bigTurn) && game.runTurn(smallTurn);
+
+    AllocCounter::reset();
+    for (int turn = 0; turn < 10; turn++)
+    {
+        stringstream &input = turn % 2 ? smallTurn : bigTurn;
+        input.clear();
+        input.seekg(0);
+        played = played && game.runTurn(input);
+    }
+    uint64_t allocations = AllocCounter::allocations();
+    cout.rdbuf(coutBuf);
+    cerr.rdbuf(cerrBuf);
+
+    ASSERT_TRUE(played);
+    ASSERT_EQ(0, allocations);
+}
+
+TEST(AllocCounterTest, warmedUpTurnWithTheLiveHooksShouldNotAllocate)
+{
+    ifstream ifs("data/manyZombies.dat", std::ifstream::in);
+    stringstream bigTurn;
+    bigTurn << ifs.rdbuf();
+    ifs.close();
+    ifs.open("data/sampleRoundData.dat", std::ifstream::in);
+    stringstream smallTurn;
+    smallTurn << ifs.rdbuf();
+    NullBuffer nullBuffer;
+    streambuf* coutBuf = cout.rdbuf(&nullBuffer);
+    streambuf* cerrBuf = cerr.rdbuf(&nullBuffer);
+    GameController game;
+    game.setVerbose(true);
+    DivergenceMonitor monitor(&cerr);
+    game.setListener(&monitor);
+    EndgameSolver endgame;
+    game.setAdvisor(&endgame);
+    PonderingPlanner ponderer(5);
+    game.setPonderer(&ponderer);
+    bool played = true;
+    for (int turn = 0; turn < 4; turn++)
+    {
+        stringstream &input = turn % 2 ? smallTurn : bigTurn;
+        input.clear();
+        input.seekg(0);
+        played = played && game.runTurn(input);
+    }
+
+    AllocCounter::reset();
+    for (int turn = 0; turn < 10; turn++)
+    {
+        stringstream &input = turn % 2 ? smallTurn : bigTurn;
+        input.clear();
+        input.seekg(0);
+        played = played && game.runTurn(input);
+    }
+    uint64_t allocations = AllocCounter::allocations();
+    cout.rdbuf(coutBuf);
+    cerr.rdbuf(cerrBuf);
+
+    ASSERT_TRUE(played);
+    ASSERT_EQ(10, monitor.getCheckedTurns() - 3);
+    ASSERT_EQ(0, allocations);
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+#include "AllocCounter.hpp"
+#include "Arena.hpp"
+
+using namespace std;
+
+
+TEST(ArenaTest, allocationsShouldBeAlignedAndReusedAfterReset)
+{
+    Arena arena(256);
+
+    char* byte = static_cast<char*>(arena.allocate(1, 1));
+    double* number = static_cast<double*>(
+        arena.allocate(sizeof(double), alignof(double)));
+    arena.reset();
+    char* reused = static_cast<char*>(arena.allocate(1, 1));
+
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(number) % alignof(double));
+    ASSERT_NE(static_cast<void*>(byte), static_cast<void*>(number));
+    ASSERT_EQ(byte, reused);
+    ASSERT_EQ(1, arena.getUsed());
+    ASSERT_EQ(256, arena.getCapacity());
+}
+
+TEST(ArenaTest, scratchVectorShouldSpillIntoNewBlocksAndKeepThem)
+{
+    Arena arena(256);
+    for (int turn = 0; turn < 2; turn++)
+    {
+        arena.reset();
+        ScratchVector<int> numbers{ArenaAllocator<int>(&arena)};
+        AllocCounter::reset();
+        for (int i = 0; i < 1000; i++)
+        {
+            numbers.push_back(i);
+        }
+        if (turn > 0)
+        {
+            ASSERT_EQ(0, AllocCounter::allocations());
+        }
+        ASSERT_EQ(999, numbers.back());
+    }
+    ASSERT_GT(arena.getCapacity(), 1000*sizeof(int));
+}
+
+TEST(ArenaTest, copiedArenaShouldStartEmpty)
+{
+    Arena arena(128);
+    arena.allocate(100, 1);
+
+    Arena copy(arena);
+
+    ASSERT_EQ(0, copy.getCapacity());
+    ASSERT_EQ(128, arena.getCapacity());
+}
+
+TEST(ArenaTest, renewedVectorShouldStartEmptyAtTheFrontOfTheArena)
+{
+    Arena arena(256);
+    ScratchVector<int> numbers{ArenaAllocator<int>(&arena)};
+    numbers.push_back(1);
+    int* first = &numbers[0];
+
+    arena.reset();
+    renew(numbers);
+    numbers.push_back(2);
+
+    ASSERT_EQ(1, numbers.size());
+    ASSERT_EQ(first, &numbers[0]);
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Bounds.hpp"
+#include "Endgame.hpp"
+
+using namespace std;
+
+
+TEST(BoundsTest, looseBoundKillsEveryZombieInOneShot)
+{
+    ASSERT_EQ(40*(1 + 2 + 3), Bounds::loose(0, 2, 3));
+    ASSERT_EQ(100 + 10*(1 + 2 + 3 + 5), Bounds::loose(100, 1, 4));
+}
+
+TEST(BoundsTest, tightBoundDropsHumansThatAreCertainlyEaten)
+{
+    GameData data;
+    data.ashPos_ = Position(15000, 8000);
+    data.humanCount_ = 2;
+    data.humans_.insert(Human(0, Position(1000, 1000)));
+    data.humans_.insert(Human(1, Position(8000, 4500)));
+    data.zombieCount_ = 1;
+    data.zombies_.insert(Zombie(0, Position(1000, 1400), Position()));
+    ASSERT_EQ(1, Bounds::certainDeath(data, *data.humans_.begin()));
+    ASSERT_EQ(Bounds::comboValue(1, 1), Bounds::tight(data, 0));
+    ASSERT_EQ(Bounds::comboValue(2, 1), Bounds::loose(0, 2, 1));
+
+    data.humans_.clear();
+    data.humans_.insert(Human(0, Position(1000, 1000)));
+    ASSERT_EQ(0, Bounds::tight(data, 500));
+}
+
+TEST(BoundsTest, boundsNeverFallBelowTheFinalScore)
+{
+    for (unsigned seed = 1; seed <= 30; seed++)
+    {
+        GameData scenario = Simulator::randomScenario(
+            1 + seed % 5, 1 + seed % 9, seed);
+        GameController game;
+        game.setVerbose(false);
+        EndgameSolver endgame;
+        game.setAdvisor(&endgame);
+        Simulator sim(scenario);
+        vector<int> tight;
+        vector<int> loose;
+        while (!sim.isOver())
+        {
+            tight.push_back(Bounds::tight(sim));
+            loose.push_back(Bounds::loose(sim));
+            ASSERT_LE(tight.back(), loose.back());
+            game.loadGameData(sim.getData());
+            sim.step(game.playTurn());
+        }
+        for (unsigned turn = 0; turn < tight.size(); turn++)
+        {
+            ASSERT_GE(tight[turn], sim.getScore());
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Cleanup.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(CleanupTourTest, walksToTheRimOfAZombieStandingOnItsHuman)
+{
+    GameData data;
+    data.ashPos_ = Position(1000, 4500);
+    data.humans_.insert(Human(0, Position(6000, 4500)));
+    data.zombies_.insert(Zombie(0, Position(6000, 4500), Position(6000, 4500)));
+    CleanupTour tour;
+    ASSERT_EQ(3, tour.plan(data, 10));
+    Position move = tour.getFirstMove();
+    ASSERT_EQ(4500, move.y_);
+    ASSERT_LE(Helpers::distance(move, Position(6000, 4500)), 2000);
+    ASSERT_GE(Helpers::distance(move, Position(6000, 4500)), 1990);
+}
+
+TEST(CleanupTourTest, predictsTheTurnsOfAMovingTarget)
+{
+    GameData data;
+    data.ashPos_ = Position(1000, 8000);
+    data.humans_.insert(Human(0, Position(15000, 1000)));
+    data.humans_.insert(Human(1, Position(1000, 8500)));
+    data.zombies_.insert(Zombie(0, Position(9000, 1000), Position()));
+    data.humanCount_ = 2;
+    data.zombieCount_ = 1;
+    Simulator sim(data);
+    CleanupTour tour;
+    int planned = tour.plan(sim.getData(), 10);
+    while (sim.getZombiesAlive() > 0 && sim.getTurn() < planned + 5)
+    {
+        tour.plan(sim.getData(), 10);
+        sim.step(tour.getFirstMove());
+    }
+    ASSERT_EQ(0, sim.getZombiesAlive());
+    ASSERT_EQ(planned, sim.getTurn());
+}
+
+TEST(CleanupTourTest, localSearchNeverLengthensTheNearestFirstTour)
+{
+    for (unsigned seed = 1; seed <= 20; seed++)
+    {
+        GameData data = Simulator::randomScenario(5, 12, seed);
+        CleanupTour tour;
+        int nearestFirst = tour.plan(data, 1);
+        ASSERT_EQ(1, tour.getEvaluations());
+        int improved = tour.plan(data, 500);
+        ASSERT_LE(tour.getEvaluations(), 500);
+        ASSERT_LE(improved, nearestFirst);
+        ASSERT_GE(improved, 1);
+    }
+}
+
+TEST(CleanupTourTest, emptyBoardNeedsNoTurns)
+{
+    CleanupTour tour;
+    GameData data;
+    data.ashPos_ = Position(100, 200);
+    ASSERT_EQ(0, tour.plan(data, 10));
+    ASSERT_EQ(100, tour.getFirstMove().x_);
+    ASSERT_EQ(0, tour.getEvaluations());
+}
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <random>
+
+#include "Clusters.hpp"
+
+using namespace std;
+
+
+TEST(ZombieClustersTest, chainsNeighboursIntoOneCluster)
+{
+    FlatSet<Zombie> zombies;
+    zombies.insert(Zombie(0, Position(0, 0), Position(1000, 1000)));
+    zombies.insert(Zombie(1, Position(0, 0), Position(3500, 1000)));
+    zombies.insert(Zombie(2, Position(0, 0), Position(6000, 1000)));
+    zombies.insert(Zombie(3, Position(0, 0), Position(15000, 8000)));
+    ZombieClusters clusters;
+    clusters.build(zombies, 3000);
+    ASSERT_EQ(2, clusters.getCount());
+    ASSERT_EQ(0, clusters.clusterOf(2));
+    ASSERT_EQ(1, clusters.clusterOf(3));
+    ASSERT_EQ(3, clusters.size(0));
+    ASSERT_EQ(3500, clusters.centroid(0).x_);
+    ASSERT_EQ(1000, clusters.centroid(0).y_);
+    ASSERT_EQ(0, clusters.largest());
+    ASSERT_EQ(-1, clusters.clusterOf(7));
+}
+
+TEST(ZombieClustersTest, matchesFloodFillOverAllPairs)
+{
+    mt19937 rng(3);
+    ZombieClusters clusters;
+    for (int round = 0; round < 20; round++)
+    {
+        FlatSet<Zombie> zombies;
+        int n = 1 + rng() % 300;
+        for (int i = 0; i < n; i++)
+        {
+            Position next(rng() % 16000, rng() % 9000);
+            zombies.insert(Zombie(i*2, next, next));
+        }
+        double radius = round % 4 == 0
+            ? 50 + rng() % 150 : 200 + rng() % 2000;
+        clusters.build(zombies, radius);
+
+        vector<Zombie> all(zombies.begin(), zombies.end());
+        vector<int> label(n, -1);
+        int count = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (label[i] >= 0)
+                continue;
+            vector<int> stack(1, i);
+            label[i] = count;
+            while (!stack.empty())
+            {
+                int k = stack.back();
+                stack.pop_back();
+                for (int j = 0; j < n; j++)
+                {
+                    if (label[j] < 0 && Helpers::distance(all[k].nextPos_,
+                        all[j].nextPos_) < radius)
+                    {
+                        label[j] = count;
+                        stack.push_back(j);
+                    }
+                }
+            }
+            count++;
+        }
+        ASSERT_EQ(count, clusters.getCount());
+        for (int i = 0; i < n; i++)
+        {
+            ASSERT_EQ(label[i], clusters.clusterOf(all[i].id_));
+        }
+
+        Position center = all[rng() % n].nextPos_;
+        int sumX = 0;
+        int sumY = 0;
+        int inRange = 0;
+        vector<int> ids;
+        for (auto zombie: all)
+        {
+            if (Helpers::distance(center, zombie.nextPos_) < radius)
+            {
+                sumX += zombie.nextPos_.x_;
+                sumY += zombie.nextPos_.y_;
+                inRange++;
+                ids.push_back(zombie.id_);
+            }
+        }
+        Position neighbourhood = clusters.neighbourhoodCentroid(center);
+        ASSERT_EQ(sumX/inRange, neighbourhood.x_);
+        ASSERT_EQ(sumY/inRange, neighbourhood.y_);
+        vector<int> found;
+        clusters.neighbourhood(center, found);
+        sort(found.begin(), found.end());
+        ASSERT_EQ(ids, found);
+    }
+}
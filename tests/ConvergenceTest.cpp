@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Convergence.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(ConvergenceForecasterTest, buildsAComboLadderCutAtTheDeadline)
+{
+    GameData data;
+    data.ashPos_ = Position(0, 0);
+    data.humanCount_ = 1;
+    data.humans_.insert(Human(0, Position(10000, 4500)));
+    data.zombieCount_ = 5;
+    data.zombies_.insert(Zombie(0, Position(12500, 4500), Position()));
+    data.zombies_.insert(Zombie(1, Position(10000, 7500), Position()));
+    data.zombies_.insert(Zombie(2, Position(14000, 4500), Position()));
+    data.zombies_.insert(Zombie(3, Position(10000, 8300), Position()));
+    data.zombies_.insert(Zombie(4, Position(16000, 4500), Position()));
+    data = Simulator(data).getData();
+    TrajectoryCache trajectories;
+    trajectories.update(data);
+    ConvergenceForecaster forecaster;
+    forecaster.update(data, trajectories);
+
+    ASSERT_EQ(1, forecaster.getTargetCount());
+    int index = forecaster.findTarget(0);
+    ASSERT_EQ(0, index);
+    ASSERT_EQ(-1, forecaster.findTarget(TrajectoryCache::ashTarget));
+    ConvergenceTarget const &target = forecaster.getTarget(index);
+    ASSERT_EQ(7, target.deadline_);
+    ASSERT_EQ(11, target.ashTurns_);
+    ASSERT_EQ(3, target.steps_);
+    ASSERT_EQ(1, forecaster.getStep(index, 0).kills_);
+    ASSERT_EQ(2, forecaster.getStep(index, 0).turn_);
+    ASSERT_EQ(2, forecaster.getStep(index, 1).kills_);
+    ASSERT_EQ(3, forecaster.getStep(index, 1).turn_);
+    ASSERT_EQ(4, forecaster.getStep(index, 2).kills_);
+    ASSERT_EQ(5, forecaster.getStep(index, 2).turn_);
+    ASSERT_EQ(2, forecaster.bestKills(index, 4));
+    ASSERT_EQ(4, forecaster.bestKills(index, 20));
+}
+
+TEST(ConvergenceForecasterTest, laddersMatchPredictedPaths)
+{
+    GameData data = Simulator::randomScenario(8, 60, 17);
+    TrajectoryCache trajectories(40);
+    trajectories.update(data);
+    ConvergenceForecaster forecaster;
+    forecaster.update(data, trajectories);
+    for (int index = 0; index < forecaster.getTargetCount(); index++)
+    {
+        ConvergenceTarget const &target = forecaster.getTarget(index);
+        for (int step = 0; step < target.steps_; step++)
+        {
+            ComboStep const &combo = forecaster.getStep(index, step);
+            ASSERT_LE(combo.turn_, target.deadline_);
+            int inside = 0;
+            for (auto zombie: data.zombies_)
+            {
+                if (trajectories.getTargetId(zombie.id_) != target.targetId_)
+                    continue;
+                Position pos = trajectories.positionAt(zombie.id_,
+                    combo.turn_);
+                if (Helpers::distance(pos, target.pos_)
+                    <= Helpers::shootingRadius + 2*combo.turn_)
+                    inside++;
+            }
+            ASSERT_GE(inside, combo.kills_);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <sstream>
+
+#include "DebugLog.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+class DebugLogParserShould: public testing::Test
+{
+public:
+    string captureGameLog(string const &scenario)
+    {
+        ostringstream log;
+        streambuf* stderrBuf = cerr.rdbuf(log.rdbuf());
+        GameController game;
+        Simulator sim(Simulator::loadScenario(scenario));
+        while (!sim.isOver())
+        {
+            game.loadGameData(sim.getData());
+            Position solution = game.playTurn();
+            game.debugPrint(game.getData());
+            cerr << "State: 0" << endl;
+            turns_.push_back(game.getData());
+            sim.step(solution);
+        }
+        cerr.rdbuf(stderrBuf);
+        return log.str();
+    }
+    vector<GameData> turns_;
+};
+
+TEST_F(DebugLogParserShould, rebuildEveryTurnOfTheGame)
+{
+    istringstream log(captureGameLog("data/scenarios/crossFire.dat"));
+    DebugLogParser parser(log);
+    GameData data;
+
+    for (auto expected: turns_)
+    {
+        ASSERT_TRUE(parser.next(data));
+        ASSERT_EQ(expected.ashPos_.x_, data.ashPos_.x_);
+        ASSERT_EQ(expected.ashPos_.y_, data.ashPos_.y_);
+        ASSERT_EQ(expected.humanCount_, data.humanCount_);
+        ASSERT_EQ(expected.zombieCount_, data.zombieCount_);
+        ASSERT_EQ(expected.humans_.size(), data.humans_.size());
+        ASSERT_EQ(expected.zombies_.size(), data.zombies_.size());
+        auto zombie = data.zombies_.begin();
+        for (auto exp: expected.zombies_)
+        {
+            ASSERT_EQ(exp.id_, zombie->id_);
+            ASSERT_EQ(exp.nextPos_.x_, zombie->nextPos_.x_);
+            ASSERT_EQ(exp.nextPos_.y_, zombie->nextPos_.y_);
+            ++zombie;
+        }
+    }
+    ASSERT_FALSE(parser.next(data));
+    ASSERT_EQ(0, parser.getDroppedTurns());
+}
+
+TEST_F(DebugLogParserShould, skipForeignLinesAndDropInterruptedDumps)
+{
+    istringstream log(
+        "Standard Output Stream:\n"
+        "AshPos: 0 0\n"
+        "HumanCount: 1\n"
+        "AshPos: 100 200\n"
+        "HumanCount: 1\n"
+        "[3] 10 20, cat: 1\n"
+        "bestAngle: 0.1\n"
+        "ZombieCount: 1\n"
+        "[7] 500 600, 510 610, appeal: 1.5e-05\n"
+        "State: 0\n");
+    DebugLogParser parser(log);
+    GameData data;
+
+    ASSERT_TRUE(parser.next(data));
+    ASSERT_EQ(100, data.ashPos_.x_);
+    ASSERT_EQ(1, data.humans_.size());
+    ASSERT_EQ(Human::Category::Endangered, data.humans_.begin()->cat_);
+    ASSERT_EQ(510, data.zombies_.begin()->nextPos_.x_);
+    ASSERT_FALSE(parser.next(data));
+    ASSERT_EQ(1, parser.getDroppedTurns());
+    ASSERT_EQ(3, parser.getSkippedLines());
+}
+
+TEST_F(DebugLogParserShould, detectGameBoundaries)
+{
+    GameData first = Simulator::loadScenario("data/scenarios/simple.dat");
+    GameData second = Simulator::loadScenario("data/scenarios/twoZombies.dat");
+    Simulator sim(first);
+    sim.step(Position(8250, 4500));
+
+    ASSERT_FALSE(DebugLogParser::isNewGame(first, sim.getData()));
+    ASSERT_TRUE(DebugLogParser::isNewGame(sim.getData(), second));
+}
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Destination.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(DestinationSearchTest, refinesIntoTheNarrowLensCoveringBothZombies)
+{
+    FlatSet<Zombie> zombies;
+    zombies.insert(Zombie(0, Position(2505, 4500), Position(2505, 4500)));
+    zombies.insert(Zombie(1, Position(6495, 4500), Position(6495, 4500)));
+    Position ash(3900, 4500);
+    DestinationSearch search;
+    Position best = search.search(ash, Position(4900, 4500), zombies, 1000);
+    ASSERT_EQ(2, search.getBestKills());
+    ASSERT_GE(best.x_, 4495);
+    ASSERT_LE(best.x_, 4505);
+    ASSERT_LE(search.getEvaluations(), 1000);
+}
+
+TEST(DestinationSearchTest, smallBudgetsStillReturnTheBestPointSeen)
+{
+    FlatSet<Zombie> zombies;
+    zombies.insert(Zombie(0, Position(2500, 4500), Position(2500, 4500)));
+    Position ash(4000, 4500);
+    Position preferred(5000, 4500);
+    DestinationSearch search;
+    Position best = search.search(ash, preferred, zombies, 1);
+    ASSERT_EQ(1, search.getEvaluations());
+    ASSERT_EQ(preferred.x_, best.x_);
+    ASSERT_EQ(0, search.getBestKills());
+    search.search(ash, preferred, zombies, 0);
+    ASSERT_EQ(0, search.getEvaluations());
+    search.search(ash, preferred, zombies, 20);
+    ASSERT_EQ(1, search.getBestKills());
+}
+
+TEST(DestinationSearchTest, neverDoesWorseThanTheCoarseLattice)
+{
+    for (unsigned seed = 1; seed <= 20; seed++)
+    {
+        GameData data = Simulator::randomScenario(3, 40, seed);
+        Position ash = data.ashPos_;
+        int latticeBest = 0;
+        for (int dy = -1000; dy <= 1000; dy += 250)
+        {
+            for (int dx = -1000; dx <= 1000; dx += 250)
+            {
+                Position pos(ash.x_ + dx, ash.y_ + dy);
+                if (dx*dx + dy*dy > 1000*1000 || pos.x_ < 0 || pos.y_ < 0
+                    || pos.x_ >= Rules::mapWidth || pos.y_ >= Rules::mapHeight)
+                    continue;
+                int kills = 0;
+                for (auto zombie: data.zombies_)
+                {
+                    if (Helpers::distance(pos, zombie) <= 2000)
+                        kills++;
+                }
+                latticeBest = max(latticeBest, kills);
+            }
+        }
+        DestinationSearch search;
+        Position best = search.search(ash, ash, data.zombies_, 100000);
+        ASSERT_GE(search.getBestKills(), latticeBest);
+        ASSERT_LE(Helpers::distance(ash, best), 1000);
+    }
+}
+
+TEST(DestinationSearchTest, heatmapSkipsCoarsePointsFarBelowTheBestCell)
+{
+    GameData data;
+    data.ashPos_ = Position(8000, 4500);
+    for (int i = 0; i < 5; i++)
+    {
+        Position pos(10500 + 100*i, 4500);
+        data.zombies_.insert(Zombie(i, pos, pos));
+    }
+    TrajectoryCache trajectories;
+    trajectories.update(data);
+    KillHeatmap heatmap(1);
+    heatmap.build(data, trajectories);
+
+    DestinationSearch full;
+    full.search(data.ashPos_, data.ashPos_, data.zombies_, 100000);
+    DestinationSearch pruned;
+    pruned.search(data.ashPos_, data.ashPos_, data.zombies_, 100000,
+        &heatmap);
+    ASSERT_EQ(full.getBestKills(), pruned.getBestKills());
+    ASSERT_LT(pruned.getEvaluations(), full.getEvaluations());
+}
@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Divergence.hpp"
+
+using namespace std;
+
+
+TEST(DivergenceMonitorTest, simulatedGameNeverDiverges)
+{
+    GameController game;
+    game.setVerbose(false);
+    DivergenceMonitor monitor;
+    Simulator sim(Simulator::loadScenario("data/scenarios/comboOpportunity.dat"));
+    while (!sim.isOver())
+    {
+        GameData data = sim.getData();
+        game.loadGameData(data);
+        Position solution = game.playTurn();
+        monitor.onTurn(data, solution);
+        sim.step(solution);
+    }
+    ASSERT_LT(0, monitor.getCheckedTurns());
+    ASSERT_EQ(0, monitor.getDivergentTurns());
+}
+
+TEST(DivergenceMonitorTest, reportsCountsAndFirstOffendingEntity)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/twoZombies.dat");
+    Position solution(5000, 1000);
+    Simulator sim(data);
+    sim.step(solution);
+    GameData actual = sim.getData();
+    Zombie moved = *actual.zombies_.begin();
+    moved.pos_.x_ += 1;
+    actual.zombies_.erase(moved);
+    actual.zombies_.insert(moved);
+    actual.humans_.erase(*actual.humans_.begin());
+
+    ostringstream log;
+    DivergenceMonitor monitor(&log);
+    monitor.onTurn(data, solution);
+    ASSERT_FALSE(monitor.check(actual));
+    ASSERT_EQ(1, monitor.getDivergentTurns());
+    ASSERT_EQ(0, monitor.getAshMismatches());
+    ASSERT_EQ(1, monitor.getZombieMismatches());
+    ASSERT_EQ(1, monitor.getHumanMismatches());
+    ASSERT_THAT(log.str(), testing::HasSubstr("2 mismatches, first zombie 0"));
+}
+
+TEST(DivergenceMonitorTest, liveLoopFeedsTheListener)
+{
+    ifstream ifs("data/scenarios/simple.dat", std::ifstream::in);
+    string turn((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    istringstream input(turn + turn);
+    ostringstream output;
+    streambuf* coutBuf = cout.rdbuf(output.rdbuf());
+    GameController game;
+    game.setVerbose(false);
+    DivergenceMonitor monitor;
+    game.setListener(&monitor);
+    while (game.runTurn(input))
+    {}
+    cout.rdbuf(coutBuf);
+    ASSERT_EQ(1, monitor.getCheckedTurns());
+    ASSERT_EQ(1, monitor.getAshMismatches());
+}
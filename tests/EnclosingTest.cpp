@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "Enclosing.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+namespace
+{
+bool enclosesAll(double x, double y, double radius,
+    vector<Position> const &points)
+{
+    for (auto point: points)
+    {
+        if (hypot(point.x_ - x, point.y_ - y) > radius + 1e-6)
+            return false;
+    }
+    return true;
+}
+
+// Smallest circle spanned by two or three of the points that holds them
+// all; the minimum enclosing circle is always one of these.
+double bruteForceRadius(vector<Position> const &points)
+{
+    int n = points.size();
+    double best = n == 1 ? 0 : HUGE_VAL;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = i + 1; j < n; j++)
+        {
+            Position a = points[i];
+            Position b = points[j];
+            double radius = hypot(a.x_ - b.x_, a.y_ - b.y_)/2;
+            if (radius < best && enclosesAll((a.x_ + b.x_)/2.0,
+                (a.y_ + b.y_)/2.0, radius, points))
+                best = radius;
+            for (int k = j + 1; k < n; k++)
+            {
+                Position c = points[k];
+                double bx = b.x_ - a.x_, by = b.y_ - a.y_;
+                double cx = c.x_ - a.x_, cy = c.y_ - a.y_;
+                double det = 2*(bx*cy - by*cx);
+                if (det == 0)
+                    continue;
+                double ux = (cy*(bx*bx + by*by) - by*(cx*cx + cy*cy))/det;
+                double uy = (bx*(cx*cx + cy*cy) - cx*(bx*bx + by*by))/det;
+                radius = hypot(ux, uy);
+                if (radius < best
+                    && enclosesAll(a.x_ + ux, a.y_ + uy, radius, points))
+                    best = radius;
+            }
+        }
+    }
+    return best;
+}
+}
+
+TEST(EnclosingCircleTest, matchesBruteForceOnRandomGroups)
+{
+    mt19937 rng(9);
+    EnclosingCircle mec(4);
+    for (int round = 0; round < 200; round++)
+    {
+        vector<Position> points;
+        int n = 1 + rng() % 12;
+        for (int i = 0; i < n; i++)
+        {
+            points.push_back(Position(rng() % 6000, rng() % 6000));
+        }
+        Circle circle = mec.solve(points);
+        ASSERT_TRUE(enclosesAll(circle.x_, circle.y_, circle.radius_, points));
+        ASSERT_NEAR(bruteForceRadius(points), circle.radius_, 1e-6);
+    }
+}
+
+TEST(EnclosingCircleTest, abortsWithALowerBoundOnceTheLimitIsPassed)
+{
+    vector<Position> points = {Position(0, 0), Position(3000, 0),
+        Position(1500, 1000), Position(9000, 0)};
+    EnclosingCircle mec;
+    ASSERT_FALSE(mec.fits(points, 2000));
+    ASSERT_GT(mec.getCircle().radius_, 2000);
+    ASSERT_LE(mec.getCircle().radius_, 4500);
+    points.pop_back();
+    ASSERT_TRUE(mec.fits(points, 2000));
+    ASSERT_DOUBLE_EQ(1500, mec.getCircle().radius_);
+    ASSERT_EQ(1500, mec.shotPoint().x_);
+}
+
+TEST(EnclosingCircleTest, findsTheFirstTurnAConvergingGroupFitsOneShot)
+{
+    GameData data;
+    data.ashPos_ = Position(8000, 8999);
+    data.humanCount_ = 1;
+    data.humans_.insert(Human(0, Position(8000, 4500)));
+    data.zombieCount_ = 3;
+    data.zombies_.insert(Zombie(0, Position(2000, 4500), Position()));
+    data.zombies_.insert(Zombie(1, Position(14000, 4500), Position()));
+    data.zombies_.insert(Zombie(2, Position(8000, 500), Position()));
+    data = Simulator(data).getData();
+    TrajectoryCache cache(30);
+    cache.update(data);
+    vector<int> ids = {0, 1, 2};
+
+    EnclosingCircle mec;
+    int turn = mec.firstSingleShot(cache, ids, 30);
+    int expected = -1;
+    for (int t = 0; t <= 30 && expected < 0; t++)
+    {
+        vector<Position> points;
+        for (auto id: ids)
+        {
+            points.push_back(cache.positionAt(id, t));
+        }
+        if (bruteForceRadius(points) <= Helpers::shootingRadius - 1)
+            expected = t;
+    }
+    ASSERT_EQ(expected, turn);
+    ASSERT_GT(turn, 0);
+    ASSERT_EQ(-1, mec.firstSingleShot(cache, ids, turn - 1));
+}
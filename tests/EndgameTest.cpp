@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Endgame.hpp"
+
+using namespace std;
+
+
+class EndgameSolverShould: public testing::Test
+{
+public:
+    GameData twoSidedAttack()
+    {
+        GameData data;
+        data.ashPos_ = Position(8000, 4500);
+        data.humanCount_ = 2;
+        data.humans_.insert(Human(0, Position(0, 0)));
+        data.humans_.insert(Human(1, Position(15999, 8999)));
+        data.zombieCount_ = 2;
+        data.zombies_.insert(Zombie(0, Position(12000, 4500), Position()));
+        data.zombies_.insert(Zombie(1, Position(3600, 4500), Position()));
+        return Simulator(data).getData();
+    }
+};
+
+TEST_F(EndgameSolverShould, lineUpBothZombiesForOneShot)
+{
+    EndgameSolver solver;
+    ASSERT_EQ(40*(1 + 2), solver.solve(twoSidedAttack()));
+}
+
+TEST_F(EndgameSolverShould, reachThePredictedScoreWhenReplanningEveryTurn)
+{
+    Simulator sim(twoSidedAttack());
+    EndgameSolver solver;
+    int expected = solver.solve(sim.getData());
+    while (!sim.isOver())
+    {
+        Position move;
+        ASSERT_TRUE(solver.advise(sim.getData(), move));
+        sim.step(move);
+    }
+    ASSERT_EQ(expected, sim.getScore());
+}
+
+TEST_F(EndgameSolverShould, pruneBranchesThatCannotBeatTheBest)
+{
+    GameData data = twoSidedAttack();
+    data.zombies_.insert(Zombie(2, Position(8000, 500), Position()));
+    data.zombies_.insert(Zombie(3, Position(8000, 8500), Position()));
+    data = Simulator(data).getData();
+    EndgameSolver solver;
+    solver.solve(data);
+    ASSERT_GT(solver.getPruned(), 0);
+    ASSERT_GE(solver.getBestScore(), 40*(1 + 1 + 1 + 1));
+}
+
+TEST_F(EndgameSolverShould, leaveCrowdedBoardsToTheHeuristic)
+{
+    GameData data = Simulator::randomScenario(3, EndgameSolver::maxZombies + 1,
+        5);
+    EndgameSolver solver;
+    Position move;
+    ASSERT_FALSE(solver.advise(data, move));
+}
@@ -31,7 +31,8 @@ TEST(HelperFunctionsTest, stepShouldReturnNumberOfRoundsToReachTarget)
 
     ASSERT_EQ(1, Helpers::steps(human, zombie));
     ASSERT_EQ(3, Helpers::steps(human, ash));
-    ASSERT_EQ(4, Helpers::steps(ash, zombie));
+    // the zombie walks towards Ash, so they meet a turn earlier
+    ASSERT_EQ(3, Helpers::steps(ash, zombie));
     zombie.nextPos_.x_ = 3000;
     ASSERT_EQ(0, Helpers::steps(human, zombie));
     ASSERT_EQ(3, Helpers::steps(ash, zombie));
@@ -246,8 +247,8 @@ TEST_F(GameControllerShould, returnCorrectNumberOfNeighboursForZombies)
 {
     GameData dat;
     ifstream ifs;
-    vector<Zombie> zombieNeighbours1;
-    vector<Zombie> zombieNeighbours2;
+    vector<int> zombieNeighbours1;
+    vector<int> zombieNeighbours2;
     Zombie zombie1(0, Position(), Position());
     Zombie zombie2(16, Position(), Position());
 
@@ -257,12 +258,12 @@ TEST_F(GameControllerShould, returnCorrectNumberOfNeighboursForZombies)
     sut_.loadGameData(ifs);
     ifs.close();
     dat = sut_.getData();
-    zombieNeighbours1 = sut_.selectZombiesFromNeighbourhood(
-        *(dat.zombies_.find(zombie1)),
-        dat.zombies_);
-    zombieNeighbours2 = sut_.selectZombiesFromNeighbourhood(
-        *(dat.zombies_.find(zombie2)),
-        dat.zombies_);
+    sut_.getClusters().neighbourhood(
+        dat.zombies_.find(zombie1)->nextPos_,
+        zombieNeighbours1);
+    sut_.getClusters().neighbourhood(
+        dat.zombies_.find(zombie2)->nextPos_,
+        zombieNeighbours2);
     ASSERT_EQ(2, zombieNeighbours1.size());
     ASSERT_EQ(3, zombieNeighbours2.size());
 }
\ No newline at end of file
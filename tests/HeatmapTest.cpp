@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Heatmap.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+namespace
+{
+Position cellCentre(Position pos)
+{
+    int size = KillHeatmap::cellSize;
+    return Position(pos.x_/size*size + size/2, pos.y_/size*size + size/2);
+}
+}
+
+TEST(KillHeatmapTest, countsZombiesInRangeOfEveryCellCentre)
+{
+    GameData data = Simulator::randomScenario(5, 99, 23);
+    TrajectoryCache trajectories;
+    trajectories.update(data);
+    KillHeatmap heatmap(4);
+    heatmap.build(data, trajectories);
+    for (int turn = 1; turn <= heatmap.getTurns(); turn++)
+    {
+        for (int x = 125; x < Rules::mapWidth; x += 750)
+        {
+            for (int y = 125; y < Rules::mapHeight; y += 500)
+            {
+                int expected = 0;
+                for (auto zombie: data.zombies_)
+                {
+                    Position pos = cellCentre(
+                        trajectories.positionAt(zombie.id_, turn));
+                    if (Helpers::distance(Position(x, y), pos)
+                        <= Helpers::shootingRadius)
+                        expected++;
+                }
+                ASSERT_EQ(expected, heatmap.countAt(turn, Position(x, y)));
+            }
+        }
+    }
+}
+
+TEST(KillHeatmapTest, bestReachableCellStaysWithinReach)
+{
+    GameData data;
+    data.ashPos_ = Position(500, 4500);
+    data.humanCount_ = 1;
+    data.humans_.insert(Human(0, Position(15000, 4500)));
+    data.zombieCount_ = 3;
+    data.zombies_.insert(Zombie(0, Position(8000, 4500), Position()));
+    data.zombies_.insert(Zombie(1, Position(8000, 5000), Position()));
+    data.zombies_.insert(Zombie(2, Position(8000, 4000), Position()));
+    data = Simulator(data).getData();
+    TrajectoryCache trajectories;
+    trajectories.update(data);
+    KillHeatmap heatmap(10);
+    heatmap.build(data, trajectories);
+
+    int count = -1;
+    Position best = heatmap.bestReachableCell(2, data.ashPos_, count);
+    ASSERT_EQ(0, count);
+    ASSERT_EQ(625, best.x_);
+    best = heatmap.bestReachableCell(9, data.ashPos_, count);
+    ASSERT_EQ(0, count);
+    best = heatmap.bestReachableCell(10, data.ashPos_, count);
+    ASSERT_EQ(3, count);
+    ASSERT_LE(Helpers::distance(data.ashPos_, best), 10000);
+    ASSERT_EQ(3, heatmap.countAt(10, best));
+}
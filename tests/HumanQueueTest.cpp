@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(HumanQueueTest, triageMatchesTheFullRescanEveryTurn)
+{
+    int rescans = 0;
+    int humanTurns = 0;
+    for (unsigned seed = 1; seed <= 5; seed++)
+    {
+        GameController game;
+        game.setVerbose(false);
+        GameController reference;
+        reference.setVerbose(false);
+        Simulator sim(Simulator::randomScenario(40, 60, seed));
+        int turn = 0;
+        while (!sim.isOver())
+        {
+            GameData data = sim.getData();
+            game.loadGameData(data);
+            game.doTheTriage();
+            reference.loadGameData(data);
+            GameData expected = reference.getData();
+            reference.doTheTriage(expected.humans_);
+            GameData actual = game.getData();
+            for (auto human: expected.humans_)
+            {
+                ASSERT_EQ(human.cat_, actual.humans_.find(human)->cat_);
+            }
+            if (turn++ > 0)
+            {
+                rescans += game.getHumanQueue().getRescans();
+                humanTurns += data.humans_.size();
+            }
+            sim.step(game.playTurn());
+        }
+    }
+    ASSERT_LT(rescans, humanTurns*3/4);
+}
+
+TEST(HumanQueueTest, topIsTheHumanEatenFirst)
+{
+    GameData data = Simulator::randomScenario(30, 20, 3);
+    HumanQueue queue;
+    queue.update(data);
+    ASSERT_EQ(30, queue.size());
+    for (int i = 0; i < queue.size(); i++)
+    {
+        ASSERT_LE(queue.top().deathTurns_, queue.at(i).deathTurns_);
+        ASSERT_EQ(queue.at(i).humanId_,
+            queue.find(queue.at(i).humanId_)->humanId_);
+    }
+}
+
+TEST(HumanQueueTest, unrelatedInputRebuildsTheQueue)
+{
+    HumanQueue queue;
+    queue.update(Simulator::randomScenario(10, 10, 1));
+    queue.update(Simulator::randomScenario(12, 10, 2));
+    ASSERT_EQ(12, queue.getRescans());
+    ASSERT_EQ(12, queue.size());
+}
+
+TEST(HumanQueueTest, goToClosestEndangeredPicksTheMostUrgentHuman)
+{
+    GameData data;
+    data.ashPos_ = Position(0, 0);
+    data.humanCount_ = 2;
+    data.humans_.insert(Human(0, Position(5000, 0)));
+    data.humans_.insert(Human(1, Position(0, 4000)));
+    data.zombieCount_ = 2;
+    data.zombies_.insert(Zombie(0, Position(7000, 0), Position(7000, 0)));
+    data.zombies_.insert(Zombie(1, Position(0, 5200), Position(0, 5200)));
+    GameController game;
+    game.setVerbose(false);
+    game.loadGameData(data);
+    game.doTheTriage();
+    GameData triaged = game.getData();
+    ASSERT_EQ(Human::Category::Endangered, triaged.humans_.begin()->cat_);
+    ASSERT_EQ(Human::Category::Endangered, triaged.humans_.rbegin()->cat_);
+    Position target = game.goToClosestEndangered();
+    ASSERT_EQ(0, target.x_);
+    ASSERT_EQ(4000, target.y_);
+}
@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "Intercept.hpp"
+
+using namespace std;
+
+
+TEST(InterceptTest, zombieAlreadyInRangeNeedsNoTurn)
+{
+    Zombie zombie(0, Position(1500, 0), Position(1900, 0));
+    Interception result = Intercept::solve(Position(0, 0), zombie);
+    ASSERT_EQ(0, result.turns_);
+    ASSERT_EQ(1500, result.point_.x_);
+}
+
+TEST(InterceptTest, fleeingZombieIsCaughtLater)
+{
+    Zombie zombie(0, Position(5000, 0), Position(5400, 0));
+    Interception result = Intercept::solve(Position(0, 0), zombie);
+    ASSERT_EQ(5, result.turns_);
+    ASSERT_EQ(7000, result.point_.x_);
+    ASSERT_EQ(0, result.point_.y_);
+}
+
+TEST(InterceptTest, matchesTurnByTurnSearch)
+{
+    mt19937 rng(11);
+    FlatSet<Zombie> zombies;
+    Position ash(rng() % 16000, rng() % 9000);
+    for (int i = 0; i < 2000; i++)
+    {
+        Position pos(rng() % 16000, rng() % 9000);
+        double angle = (rng() % 6283)/1000.0;
+        Position next(pos.x_ + 400*cos(angle), pos.y_ + 400*sin(angle));
+        zombies.insert(Zombie(i, pos, next));
+    }
+    vector<Interception> batch;
+    Intercept::solveAll(ash, zombies, batch);
+    ASSERT_EQ(zombies.size(), batch.size());
+    unsigned i = 0;
+    for (auto zombie: zombies)
+    {
+        double vx = zombie.nextPos_.x_ - zombie.pos_.x_;
+        double vy = zombie.nextPos_.y_ - zombie.pos_.y_;
+        int turns = 0;
+        while (hypot(zombie.pos_.x_ + vx*turns - ash.x_,
+            zombie.pos_.y_ + vy*turns - ash.y_) > 2000 + 1000*turns)
+        {
+            turns++;
+        }
+        ASSERT_EQ(turns, batch[i].turns_);
+        ASSERT_EQ(turns, Intercept::solve(ash, zombie).turns_);
+        i++;
+    }
+}
@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "PerfCounters.hpp"
+
+using namespace std;
+
+
+TEST(PerfCountersTest, unavailableCountersShouldReadZero)
+{
+    PerfCounters perf;
+    volatile double sum = 0;
+
+    perf.start();
+    for (int i = 0; i < 100000; i++)
+    {
+        sum += i*0.5;
+    }
+    PerfCounters::Sample sample = perf.stop();
+
+    for (int e = 0; e < PerfCounters::eventCount; e++)
+    {
+        if (!perf.isAvailable(PerfCounters::Event(e)))
+        {
+            ASSERT_EQ(0, sample.values_[e]);
+        }
+    }
+    if (perf.isAvailable(PerfCounters::instructions))
+    {
+        ASSERT_GT(sample.values_[PerfCounters::instructions], 100000);
+    }
+    ASSERT_LE(sample.timeRunning_, sample.timeEnabled_);
+    ASSERT_STREQ("LLC-misses", PerfCounters::eventName(PerfCounters::llcMisses));
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <thread>
+
+#include "Planner.hpp"
+
+using namespace std;
+
+
+TEST(PlannerTest, iterationLimitBoundsTheSearchAndKeepsTheRestOfThePlan)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/comboOpportunity.dat");
+    Planner planner;
+    planner.setMaxIterations(50);
+    planner.plan(data, 10000);
+    ASSERT_EQ(50, planner.getIterations());
+    ASSERT_LT(0, planner.getBestScore());
+    ASSERT_FALSE(planner.getBestPlan().empty());
+}
+
+TEST(PlannerTest, stopEndsTheSearchBeforeTheBudget)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/besieged.dat");
+    Planner planner;
+    thread stopper([&planner]()
+    {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        planner.stop();
+    });
+    auto start = chrono::steady_clock::now();
+    planner.plan(data, 60000);
+    double seconds = chrono::duration<double>(
+        chrono::steady_clock::now() - start).count();
+    stopper.join();
+    ASSERT_LT(seconds, 10.0);
+    ASSERT_LT(0, planner.getIterations());
+}
+
+TEST(PlannerTest, plannedGameScoresAtLeastAsWellAsTheHeuristic)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/twoZombies.dat");
+    Planner planner;
+    planner.setMaxIterations(200);
+    Simulator sim(data);
+    while (!sim.isOver())
+    {
+        sim.step(planner.plan(sim.getData(), 10000));
+    }
+    ASSERT_LE(Simulator::playGame(data, StrategyParams()), sim.getScore());
+}
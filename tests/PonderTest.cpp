@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "Ponder.hpp"
+
+using namespace std;
+
+
+namespace
+{
+string turnText(GameData const &data)
+{
+    ostringstream out;
+    out << data.ashPos_.x_ << " " << data.ashPos_.y_ << endl
+        << data.humans_.size() << endl;
+    for (auto human: data.humans_)
+    {
+        out << human.id_ << " " << human.pos_.x_ << " "
+            << human.pos_.y_ << endl;
+    }
+    out << data.zombies_.size() << endl;
+    for (auto zombie: data.zombies_)
+    {
+        out << zombie.id_ << " " << zombie.pos_.x_ << " " << zombie.pos_.y_
+            << " " << zombie.nextPos_.x_ << " " << zombie.nextPos_.y_ << endl;
+    }
+    return out.str();
+}
+}
+
+TEST(PonderingPlannerTest, matchingInputKeepsThePonderedSearch)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/comboOpportunity.dat");
+    Position move(8000, 4500);
+    Simulator sim(data);
+    sim.step(move);
+    PonderingPlanner ponderer;
+    ponderer.getPlanner().setMaxIterations(50);
+    ponderer.ponder(data, move);
+    this_thread::sleep_for(chrono::milliseconds(200));
+    ponderer.collect(sim.getData());
+    ASSERT_EQ(1, ponderer.getHits());
+    ASSERT_EQ(0, ponderer.getMisses());
+    ASSERT_EQ(50, ponderer.getPonderedRollouts());
+    ASSERT_FALSE(ponderer.getPlanner().getBestPlan().empty());
+}
+
+TEST(PonderingPlannerTest, divergentInputDropsThePonderedSearch)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/comboOpportunity.dat");
+    PonderingPlanner ponderer;
+    ponderer.getPlanner().setMaxIterations(50);
+    ponderer.ponder(data, Position(8000, 4500));
+    Simulator sim(data);
+    sim.step(Position(0, 0));
+    ponderer.collect(sim.getData());
+    ASSERT_EQ(0, ponderer.getHits());
+    ASSERT_EQ(1, ponderer.getMisses());
+    ASSERT_TRUE(ponderer.getPlanner().getBestPlan().empty());
+}
+
+TEST(PonderingPlannerTest, collectStopsAnUnboundedSearch)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/besieged.dat");
+    PonderingPlanner ponderer;
+    auto start = chrono::steady_clock::now();
+    ponderer.ponder(data, data.ashPos_);
+    this_thread::sleep_for(chrono::milliseconds(20));
+    Simulator sim(data);
+    sim.step(data.ashPos_);
+    ponderer.collect(sim.getData());
+    double ms = chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start).count();
+    ASSERT_LT(ms, PonderingPlanner::maxPonderMs);
+    ASSERT_LT(0, ponderer.getPonderedRollouts());
+}
+
+TEST(PonderingPlannerTest, liveLoopPondersBetweenTurns)
+{
+    GameData data = Simulator::loadScenario("data/scenarios/twoZombies.dat");
+    ostringstream output;
+    streambuf* coutBuf = cout.rdbuf(output.rdbuf());
+    GameController game;
+    game.setVerbose(false);
+    PonderingPlanner ponderer(5);
+    ponderer.getPlanner().setMaxIterations(100);
+    game.setPonderer(&ponderer);
+    Simulator sim(data);
+    bool played = true;
+    while (played && !sim.isOver())
+    {
+        istringstream input(turnText(sim.getData()));
+        output.str("");
+        played = game.runTurn(input);
+        istringstream written(output.str());
+        Position move;
+        written >> move.x_ >> move.y_;
+        sim.step(move);
+    }
+    cout.rdbuf(coutBuf);
+    ASSERT_TRUE(played);
+    ASSERT_LT(0, sim.getTurn() - 1);
+    ASSERT_EQ(sim.getTurn() - 1, ponderer.getHits());
+    ASSERT_EQ(0, ponderer.getMisses());
+    ASSERT_LE(Simulator::playGame(data, StrategyParams()), sim.getScore());
+}
+
+TEST(PonderingPlannerTest, adviceStopsAtTheTurnBudgetOnABigBoard)
+{
+    GameData data = Simulator::randomScenario(99, 99, 7);
+    auto start = chrono::steady_clock::now();
+    Simulator::playGame(data, StrategyParams());
+    double playoutMs = chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start).count();
+    PonderingPlanner ponderer(1);
+    Position move;
+    start = chrono::steady_clock::now();
+    ASSERT_FALSE(ponderer.advise(data, move));
+    double ms = chrono::duration<double, milli>(
+        chrono::steady_clock::now() - start).count();
+    ASSERT_LT(ms, playoutMs);
+    ASSERT_EQ(0, ponderer.getPlannedTurns());
+}
@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <sstream>
+
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(ProfilerTest, turnShouldRecordPhasesAndCounters)
+{
+    GameController game;
+    game.setVerbose(false);
+    game.loadGameData(Simulator::loadScenario("data/manyZombies.dat"));
+    Profiler::reset();
+
+    game.playTurn();
+
+    Profiler::Stats &stats = Profiler::stats;
+    ASSERT_EQ(1, stats.phases_[Profiler::chooseStrategy].calls_);
+    ASSERT_EQ(1, stats.phases_[Profiler::doTheTriage].calls_);
+    ASSERT_EQ(1, stats.phases_[Profiler::rateZombies].calls_);
+    ASSERT_EQ(1, stats.phases_[Profiler::attackMostDenseZombie].calls_);
+    ASSERT_EQ(0, stats.phases_[Profiler::loadGameData].calls_);
+    ASSERT_GT(stats.counters_[Profiler::distanceEvaluations], 0);
+    ASSERT_GE(stats.counters_[Profiler::zombiesScanned], 7*7);
+}
+
+TEST(ProfilerTest, reportShouldListRecordedPhasesOnly)
+{
+    ostringstream out;
+    Profiler::reset();
+    Profiler::record(Profiler::writeSolution, 1000);
+    Profiler::record(Profiler::writeSolution, 3000);
+
+    Profiler::report(out);
+
+    ASSERT_EQ(2, Profiler::stats.phases_[Profiler::writeSolution].calls_);
+    ASSERT_EQ(3000, Profiler::stats.phases_[Profiler::writeSolution].maxNs_);
+    ASSERT_NE(string::npos, out.str().find("writeSolution: 2, 4, 2000, 3000"));
+    ASSERT_NE(string::npos, out.str().find("<1024ns:1 <4096ns:1"));
+    ASSERT_EQ(string::npos, out.str().find("rateZombies"));
+}
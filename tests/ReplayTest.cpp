@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdio>
+
+#include "Replay.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+class ReplayShould: public testing::Test
+{
+public:
+    ReplayShould(): path_("replayTest.cvzr")
+    {
+        remove(path_.c_str());
+    }
+    ~ReplayShould()
+    {
+        remove(path_.c_str());
+    }
+    void recordGame(ReplayWriter &writer, string const &scenario)
+    {
+        GameController game;
+        game.setVerbose(false);
+        Simulator sim(Simulator::loadScenario(scenario));
+        writer.beginGame();
+        while (!sim.isOver())
+        {
+            GameData data = sim.getData();
+            game.loadGameData(data);
+            Position solution = game.playTurn();
+            writer.writeTurn(data, solution);
+            turns_.push_back(data);
+            solutions_.push_back(solution);
+            sim.step(solution);
+        }
+    }
+    string path_;
+    vector<GameData> turns_;
+    vector<Position> solutions_;
+};
+
+TEST_F(ReplayShould, readBackEveryRecordedTurn)
+{
+    ReplayWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    recordGame(writer, "data/scenarios/comboOpportunity.dat");
+    writer.close();
+
+    ReplayReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    GameData data;
+    Position solution;
+    for (unsigned turn = 0; turn < turns_.size(); turn++)
+    {
+        ASSERT_TRUE(reader.next(data, solution));
+        ASSERT_EQ(turn == 0, reader.isNewGame());
+        ASSERT_EQ(solutions_[turn].x_, solution.x_);
+        ASSERT_EQ(solutions_[turn].y_, solution.y_);
+        ASSERT_EQ(turns_[turn].ashPos_.x_, data.ashPos_.x_);
+        ASSERT_EQ(turns_[turn].humanCount_, data.humanCount_);
+        ASSERT_EQ(turns_[turn].zombieCount_, data.zombieCount_);
+        auto expected = turns_[turn].zombies_.begin();
+        for (auto zombie: data.zombies_)
+        {
+            ASSERT_EQ(expected->id_, zombie.id_);
+            ASSERT_EQ(expected->pos_.x_, zombie.pos_.x_);
+            ASSERT_EQ(expected->pos_.y_, zombie.pos_.y_);
+            ASSERT_EQ(expected->nextPos_.x_, zombie.nextPos_.x_);
+            ASSERT_EQ(expected->nextPos_.y_, zombie.nextPos_.y_);
+            ++expected;
+        }
+    }
+    ASSERT_FALSE(reader.next(data, solution));
+}
+
+TEST_F(ReplayShould, appendGamesToAnExistingLog)
+{
+    ReplayWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    recordGame(writer, "data/scenarios/simple.dat");
+    writer.close();
+    unsigned firstGameTurns = turns_.size();
+    ASSERT_TRUE(writer.open(path_));
+    recordGame(writer, "data/scenarios/twoZombies.dat");
+    writer.close();
+
+    ReplayReader reader;
+    ASSERT_TRUE(reader.open(path_));
+    GameData data;
+    Position solution;
+    int games = 0;
+    unsigned turns = 0;
+    while (reader.next(data, solution))
+    {
+        if (reader.isNewGame())
+        {
+            ASSERT_TRUE(turns == 0 || turns == firstGameTurns);
+            games++;
+        }
+        ASSERT_EQ(turns_[turns].ashPos_.y_, data.ashPos_.y_);
+        turns++;
+    }
+    ASSERT_EQ(2, games);
+    ASSERT_EQ(turns_.size(), turns);
+}
+
+TEST_F(ReplayShould, takeFewBytesPerZombie)
+{
+    ReplayWriter writer;
+    ASSERT_TRUE(writer.open(path_));
+    recordGame(writer, "data/scenarios/besieged.dat");
+    uint64_t entities = 0;
+    for (auto turn: turns_)
+    {
+        entities += turn.humanCount_ + turn.zombieCount_;
+    }
+
+    ASSERT_LT(writer.getBytesWritten(), 8*entities);
+}
+
+TEST_F(ReplayShould, rejectFilesWithoutTheReplayHeader)
+{
+    ReplayReader reader;
+
+    ASSERT_FALSE(reader.open("data/sampleRoundData.dat"));
+    ASSERT_FALSE(reader.open(path_));
+}
@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "Rescue.hpp"
+
+using namespace std;
+
+
+namespace
+{
+int bruteForce(Position ash, vector<RescueTarget> const &targets, int &turns)
+{
+    vector<int> order(targets.size());
+    for (unsigned i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    int bestSaved = -1;
+    do
+    {
+        int saved = 0;
+        int time = 0;
+        Position pos = ash;
+        for (auto index: order)
+        {
+            double dist = Helpers::distance(pos, targets[index].pos_);
+            int cover = dist <= 2000 ? 0 : ceil((dist - 2000)/1000);
+            if (time + cover >= targets[index].deadline_)
+                continue;
+            time += ceil(dist/1000);
+            pos = targets[index].pos_;
+            saved++;
+        }
+        if (saved > bestSaved || (saved == bestSaved && time < turns))
+        {
+            bestSaved = saved;
+            turns = time;
+        }
+    }
+    while (next_permutation(order.begin(), order.end()));
+    return bestSaved;
+}
+}
+
+TEST(RescueSchedulerTest, rescuesTheFarUrgentHumanFirstToSaveBoth)
+{
+    vector<RescueTarget> targets = {
+        {0, Position(3000, 0), 20, {RescueTarget::noIntercept, Position()}},
+        {1, Position(-6000, 0), 5, {RescueTarget::noIntercept, Position()}}};
+    RescueScheduler scheduler;
+    RescuePlan plan = scheduler.schedule(Position(0, 0), targets);
+    ASSERT_EQ(2, plan.saved_);
+    ASSERT_EQ(15, plan.turns_);
+    ASSERT_THAT(plan.order_, testing::ElementsAre(1, 0));
+    ASSERT_EQ(-6000, plan.waypoints_.front().x_);
+}
+
+TEST(RescueSchedulerTest, interceptsTheZombieOfAHumanOutOfReach)
+{
+    Zombie zombie(0, Position(3000, 0), Position(3400, 0));
+    vector<RescueTarget> targets = {
+        {0, Position(10000, 0), 3, Intercept::solve(Position(0, 0), zombie)}};
+    RescueScheduler scheduler;
+    RescuePlan plan = scheduler.scheduleExact(Position(0, 0), targets);
+    ASSERT_EQ(1, plan.saved_);
+    ASSERT_EQ(2, plan.turns_);
+    ASSERT_EQ(3800, plan.waypoints_.front().x_);
+    plan = scheduler.scheduleGreedy(Position(0, 0), targets);
+    ASSERT_EQ(1, plan.saved_);
+    ASSERT_EQ(3800, plan.waypoints_.front().x_);
+    targets[0].intercept_.turns_ = RescueTarget::noIntercept;
+    ASSERT_EQ(0, scheduler.scheduleExact(Position(0, 0), targets).saved_);
+}
+
+TEST(RescueSchedulerTest, exactPlanMatchesBruteForce)
+{
+    mt19937 rng(5);
+    RescueScheduler scheduler;
+    for (int round = 0; round < 30; round++)
+    {
+        vector<RescueTarget> targets;
+        int n = 1 + rng() % 6;
+        for (int i = 0; i < n; i++)
+        {
+            RescueTarget target = {i,
+                Position(rng() % 16000, rng() % 9000), int(1 + rng() % 25),
+                {RescueTarget::noIntercept, Position()}};
+            targets.push_back(target);
+        }
+        Position ash(rng() % 16000, rng() % 9000);
+        int turns = 0;
+        int saved = bruteForce(ash, targets, turns);
+        RescuePlan plan = scheduler.scheduleExact(ash, targets);
+        ASSERT_EQ(saved, plan.saved_);
+        ASSERT_EQ(turns, plan.turns_);
+        ASSERT_EQ(unsigned(saved), plan.waypoints_.size());
+    }
+}
+
+TEST(RescueSchedulerTest, largeSetsFallBackToGreedyWithTwoOpt)
+{
+    vector<RescueTarget> targets;
+    for (int i = 0; i < 20; i++)
+    {
+        RescueTarget target = {i, Position((i*7 % 20)*700, 4500), 1000,
+            {RescueTarget::noIntercept, Position()}};
+        targets.push_back(target);
+    }
+    RescueScheduler scheduler;
+    RescuePlan plan = scheduler.schedule(Position(0, 4500), targets);
+    ASSERT_EQ(20, plan.saved_);
+    ASSERT_EQ(19, plan.turns_);
+    ASSERT_EQ(0, plan.waypoints_.front().x_);
+}
@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Simulator.hpp"
+
+using namespace std;
+
+
+TEST(RulesTest, comboMultiplierFollowsFibonacciSequence)
+{
+    ASSERT_EQ(1, Rules::comboMultiplier(1));
+    ASSERT_EQ(2, Rules::comboMultiplier(2));
+    ASSERT_EQ(3, Rules::comboMultiplier(3));
+    ASSERT_EQ(5, Rules::comboMultiplier(4));
+    ASSERT_EQ(8, Rules::comboMultiplier(5));
+    ASSERT_EQ(10*3*3*5, Rules::killScore(3, 4));
+}
+
+TEST(RulesTest, moveShouldStopOnTargetOrAfterOneStep)
+{
+    Position reached = Rules::move(Position(0,0), Position(300,400), 500);
+    Position moved = Rules::move(Position(0,0), Position(3000,4000), 1000);
+    ASSERT_EQ(300, reached.x_);
+    ASSERT_EQ(400, reached.y_);
+    ASSERT_EQ(600, moved.x_);
+    ASSERT_EQ(800, moved.y_);
+}
+
+TEST(RulesTest, moveFloorsEveryComponentLikeTheReferee)
+{
+    Position exact = Rules::move(Position(0,0), Position(-3000,-4000), 1000);
+    Position slanted = Rules::move(Position(1000,0), Position(986,7310), 400);
+    ASSERT_EQ(-600, exact.x_);
+    ASSERT_EQ(-800, exact.y_);
+    ASSERT_EQ(999, slanted.x_);
+    ASSERT_EQ(399, slanted.y_);
+}
+
+TEST(RulesTest, moveMatchesLongDoubleReference)
+{
+    mt19937 rng(7);
+    for (int i = 0; i < 100000; i++)
+    {
+        Position from(rng() % Rules::mapWidth, rng() % Rules::mapHeight);
+        Position to(rng() % Rules::mapWidth, rng() % Rules::mapHeight);
+        int step = i % 2 ? Helpers::ashStepSize : Helpers::zombieStepSize;
+        long double dx = to.x_ - from.x_;
+        long double dy = to.y_ - from.y_;
+        long double dist = sqrtl(dx*dx + dy*dy);
+        Position moved = Rules::move(from, to, step);
+        if (dist <= step)
+        {
+            ASSERT_EQ(to.x_, moved.x_);
+            ASSERT_EQ(to.y_, moved.y_);
+            continue;
+        }
+        ASSERT_EQ(floorl(from.x_ + dx*step/dist), moved.x_);
+        ASSERT_EQ(floorl(from.y_ + dy*step/dist), moved.y_);
+    }
+}
+
+class SimulatorShould: public testing::Test
+{
+public:
+    GameData twoZombiesScenario()
+    {
+        GameData data;
+        data.ashPos_ = Position(8000, 4500);
+        data.humanCount_ = 2;
+        data.humans_.insert(Human(0, Position(1000, 4500)));
+        data.humans_.insert(Human(1, Position(15000, 4500)));
+        data.zombieCount_ = 2;
+        data.zombies_.insert(Zombie(0, Position(9500, 4500), Position()));
+        data.zombies_.insert(Zombie(1, Position(10200, 4500), Position()));
+        return data;
+    }
+};
+
+TEST_F(SimulatorShould, killBothZombiesInOneComboTurn)
+{
+    Simulator sim(twoZombiesScenario());
+
+    sim.step(Position(9000, 4500));
+
+    ASSERT_EQ(0, sim.getZombiesAlive());
+    ASSERT_EQ(2, sim.getHumansAlive());
+    ASSERT_EQ(Rules::killScore(2,1) + Rules::killScore(2,2), sim.getScore());
+    ASSERT_TRUE(sim.isOver());
+}
+
+TEST_F(SimulatorShould, reportZombieNextPositionsTowardsNearestHuman)
+{
+    Simulator sim(twoZombiesScenario());
+    GameData data = sim.getData();
+
+    ASSERT_EQ(2, data.zombieCount_);
+    ASSERT_EQ(9100, data.zombies_.begin()->nextPos_.x_);
+    ASSERT_EQ(9800, data.zombies_.rbegin()->nextPos_.x_);
+}
+
+TEST_F(SimulatorShould, scoreZeroWhenAllHumansAreEaten)
+{
+    GameData data;
+    data.ashPos_ = Position(15000, 8000);
+    data.humanCount_ = 1;
+    data.humans_.insert(Human(0, Position(1000, 1000)));
+    data.zombieCount_ = 1;
+    data.zombies_.insert(Zombie(0, Position(1200, 1000), Position()));
+    Simulator sim(data);
+
+    sim.step(Position(15000, 8000));
+
+    ASSERT_EQ(0, sim.getHumansAlive());
+    ASSERT_EQ(0, sim.getScore());
+    ASSERT_TRUE(sim.isOver());
+}
+
+TEST_F(SimulatorShould, playScenarioToTheEndWithTheDefaultStrategy)
+{
+    GameData scenario = Simulator::loadScenario(
+        "data/scenarios/twoZombies.dat");
+
+    int score = Simulator::playGame(scenario, StrategyParams());
+
+    ASSERT_GT(score, 0);
+}
+
+TEST_F(SimulatorShould, generateReproducibleRandomScenarios)
+{
+    GameData first = Simulator::randomScenario(5, 40, 3);
+    GameData second = Simulator::randomScenario(5, 40, 3);
+
+    ASSERT_EQ(5, first.humans_.size());
+    ASSERT_EQ(40, first.zombies_.size());
+    ASSERT_EQ(40, first.zombieCount_);
+    ASSERT_EQ(first.ashPos_.x_, second.ashPos_.x_);
+    ASSERT_EQ(first.zombies_.rbegin()->nextPos_.x_,
+        second.zombies_.rbegin()->nextPos_.x_);
+    for (auto zombie: first.zombies_)
+    {
+        ASSERT_LE(Helpers::distance(zombie.pos_, zombie.nextPos_),
+            Helpers::zombieStepSize + 1);
+    }
+}
@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdio>
+#include <sstream>
+#include <thread>
+
+#include "GameController.hpp"
+
+using namespace std;
+
+
+string readFile(string const &path)
+{
+    ifstream ifs(path.c_str(), std::ifstream::in);
+    stringstream content;
+    content << ifs.rdbuf();
+    return content.str();
+}
+
+TEST(TraceTest, eventsShouldBeWrittenOnlyWhenTracingStops)
+{
+    string path = "traceTest.json";
+    remove(path.c_str());
+    ASSERT_TRUE(Trace::start(path));
+    Trace::setThreadName("test main");
+    {
+        TRACE_SCOPE("outer", "test");
+        Profiler::ScopedTimer timer(Profiler::rateZombies);
+    }
+    thread worker([]()
+    {
+        Trace::setThreadName("test worker");
+        Trace::instant("workerTick", "test");
+        Trace::counter("queued", 3);
+    });
+    worker.join();
+
+    ASSERT_EQ("", readFile(path));
+    Trace::stop();
+    string json = readFile(path);
+    remove(path.c_str());
+
+    ASSERT_FALSE(Trace::isEnabled());
+    ASSERT_EQ(0, json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    ASSERT_NE(string::npos, json.find("\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\""));
+    ASSERT_NE(string::npos, json.find("\"name\":\"rateZombies\",\"cat\":\"phase\""));
+    ASSERT_NE(string::npos, json.find("\"args\":{\"name\":\"test worker\"}"));
+    ASSERT_NE(string::npos, json.find("\"ph\":\"C\""));
+    ASSERT_NE(string::npos, json.find("\"args\":{\"value\":3}"));
+    ASSERT_NE(string::npos, json.find("\"name\":\"workerTick\""));
+}
+
+TEST(TraceTest, disabledTracingShouldRecordNothing)
+{
+    string path = "traceTest.json";
+    remove(path.c_str());
+    {
+        TRACE_SCOPE("ignored", "test");
+        Trace::instant("ignored", "test");
+    }
+    Trace::stop();
+
+    ASSERT_EQ("", readFile(path));
+}
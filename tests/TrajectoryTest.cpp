@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "Simulator.hpp"
+#include "Trajectory.hpp"
+
+using namespace std;
+
+
+class TrajectoryCacheShould: public testing::Test
+{
+public:
+    GameData scenario()
+    {
+        GameData data;
+        data.ashPos_ = Position(0, 0);
+        data.humanCount_ = 2;
+        data.humans_.insert(Human(0, Position(15000, 8000)));
+        data.humans_.insert(Human(1, Position(9000, 8500)));
+        data.zombieCount_ = 3;
+        data.zombies_.insert(Zombie(0, Position(12000, 2000), Position()));
+        data.zombies_.insert(Zombie(1, Position(9100, 3100), Position()));
+        data.zombies_.insert(Zombie(2, Position(3000, 3000), Position()));
+        return Simulator(data).getData();
+    }
+};
+
+TEST_F(TrajectoryCacheShould, predictSimulatorPositionsWhileAshStands)
+{
+    GameData data = scenario();
+    TrajectoryCache cache(10);
+    cache.update(data);
+    Simulator sim(data);
+    for (int turn = 1; turn <= 10; turn++)
+    {
+        sim.step(data.ashPos_);
+        for (auto zombie: sim.getData().zombies_)
+        {
+            Position predicted = cache.positionAt(zombie.id_, turn);
+            ASSERT_EQ(zombie.pos_.x_, predicted.x_);
+            ASSERT_EQ(zombie.pos_.y_, predicted.y_);
+        }
+    }
+    ASSERT_EQ(0, cache.getTargetId(0));
+    ASSERT_EQ(1, cache.getTargetId(1));
+    ASSERT_EQ(TrajectoryCache::ashTarget, cache.getTargetId(2));
+    ASSERT_EQ(14, cache.turnsToTarget(1));
+}
+
+TEST_F(TrajectoryCacheShould, keepPathsUntilAnEventInvalidatesThem)
+{
+    GameData data = scenario();
+    TrajectoryCache cache;
+    cache.update(data);
+    ASSERT_EQ(3, cache.getRecomputed());
+
+    Simulator sim(data);
+    sim.step(data.ashPos_);
+    cache.update(sim.getData());
+    ASSERT_EQ(0, cache.getRecomputed());
+
+    sim.step(Position(1000, 0));
+    cache.update(sim.getData());
+    ASSERT_EQ(1, cache.getRecomputed());
+
+    GameData eaten = sim.getData();
+    eaten.humans_.erase(Human(1, Position()));
+    sim.load(eaten);
+    sim.step(eaten.ashPos_);
+    cache.update(sim.getData());
+    ASSERT_EQ(1, cache.getRecomputed());
+    ASSERT_EQ(0, cache.getTargetId(1));
+}
+
+TEST_F(TrajectoryCacheShould, switchToAshWhenItBecomesTheNearestTarget)
+{
+    GameData data = scenario();
+    TrajectoryCache cache;
+    cache.update(data);
+    Simulator sim(data);
+    sim.step(data.ashPos_);
+    GameData moved = sim.getData();
+    moved.ashPos_ = Position(9000, 3500);
+    cache.update(moved);
+    ASSERT_EQ(3, cache.getRecomputed());
+    ASSERT_EQ(TrajectoryCache::ashTarget, cache.getTargetId(0));
+    ASSERT_EQ(TrajectoryCache::ashTarget, cache.getTargetId(1));
+    ASSERT_FALSE(cache.isTracked(3));
+}
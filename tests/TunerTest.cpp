@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <sstream>
+
+#include "Tuner.hpp"
+
+using namespace std;
+
+
+TEST(CmaEsTest, shouldMinimizeShiftedSphereFunction)
+{
+    vector<double> target = {1.0, -2.0, 0.5, 3.0};
+    CmaEs cma(vector<double>(4, 0.0), 1.0, 0, 7);
+
+    for (int gen = 0; gen < 200; gen++)
+    {
+        vector<vector<double> > xs = cma.ask();
+        vector<double> costs;
+        for (auto x: xs)
+        {
+            double cost = 0;
+            for (unsigned i = 0; i < x.size(); i++)
+            {
+                cost += (x[i] - target[i])*(x[i] - target[i]);
+            }
+            costs.push_back(cost);
+        }
+        cma.tell(xs, costs);
+    }
+
+    vector<double> mean = cma.getMean();
+    for (unsigned i = 0; i < target.size(); i++)
+    {
+        ASSERT_NEAR(target[i], mean[i], 1e-3);
+    }
+}
+
+TEST(TunerTest, encodedParamsShouldDecodeToTheSameValues)
+{
+    StrategyParams params;
+    params.endangeredSteps_ = 3;
+
+    StrategyParams decoded = Tuner::decode(Tuner::encode(params));
+
+    ASSERT_NEAR(params.zombieFactor_, decoded.zombieFactor_, 1e-9);
+    ASSERT_NEAR(params.endangeredFactor_, decoded.endangeredFactor_, 1e-9);
+    ASSERT_NEAR(params.neighbourhoodRadius_,
+        decoded.neighbourhoodRadius_, 1e-9);
+    ASSERT_EQ(3, decoded.endangeredSteps_);
+}
+
+TEST(TunerTest, parallelEvaluationShouldMatchSequentialOne)
+{
+    vector<GameData> corpus;
+    corpus.push_back(Simulator::loadScenario("data/scenarios/simple.dat"));
+    corpus.push_back(Simulator::loadScenario("data/scenarios/twoZombies.dat"));
+    vector<StrategyParams> candidates(3);
+    candidates[1].ashFactor_ = 1.0;
+    candidates[2].neighbourhoodRadius_ = 1000;
+
+    vector<double> sequential = Tuner::evaluate(candidates, corpus, 1);
+    vector<double> parallel = Tuner::evaluate(candidates, corpus, 4);
+
+    ASSERT_EQ(sequential, parallel);
+}
+
+TEST(TunerTest, generatedHeaderShouldDefineAllConstants)
+{
+    ostringstream out;
+
+    Tuner::writeHeader(out, StrategyParams());
+
+    ASSERT_NE(string::npos, out.str().find("const double zombieFactor = "));
+    ASSERT_NE(string::npos, out.str().find("const double ashFactor = 40;"));
+    ASSERT_NE(string::npos, out.str().find("const int endangeredSteps = 2;"));
+}
@@ -0,0 +1,95 @@
+#include "Planner.hpp"
+
+using namespace std;
+
+void printUsage()
+{
+    cerr << "usage: anytime [-b budgetMs,...] [-r repeats] [-s seed]"
+        << " scenario.dat..." << endl;
+}
+
+vector<double> parseBudgets(string const &list)
+{
+    vector<double> budgets;
+    size_t start = 0;
+    while (start < list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == string::npos)
+            end = list.size();
+        budgets.push_back(atof(list.substr(start, end - start).c_str()));
+        start = end + 1;
+    }
+    return budgets;
+}
+
+int main(int argc, char** argv)
+{
+    vector<double> budgets = {1, 5, 10, 25, 50, 95};
+    unsigned seed = 1;
+    int repeats = 3;
+    vector<string> names;
+    vector<GameData> corpus;
+    Trace::startFromEnv();
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg[0] == '-' && i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        if (arg == "-b")
+            budgets = parseBudgets(argv[++i]);
+        else if (arg == "-r")
+            repeats = max(1, atoi(argv[++i]));
+        else if (arg == "-s")
+            seed = atoi(argv[++i]);
+        else
+        {
+            names.push_back(arg);
+            corpus.push_back(Simulator::loadScenario(arg));
+        }
+    }
+    if (corpus.empty() || budgets.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    double heuristic = 0;
+    for (auto scenario: corpus)
+    {
+        heuristic += Simulator::playGame(scenario, StrategyParams());
+    }
+    cout << "budget_ms avg_score rollouts_per_turn" << endl;
+    cout << "heuristic " << heuristic/corpus.size() << " -" << endl;
+
+    for (auto budget: budgets)
+    {
+        double total = 0;
+        long rollouts = 0;
+        long turns = 0;
+        for (int r = 0; r < repeats; r++)
+        {
+            for (unsigned g = 0; g < corpus.size(); g++)
+            {
+                Planner planner(seed + r*corpus.size() + g);
+                Simulator sim(corpus[g]);
+                while (!sim.isOver())
+                {
+                    sim.step(planner.plan(sim.getData(), budget));
+                    rollouts += planner.getIterations();
+                    turns++;
+                }
+                total += sim.getScore();
+                cerr << budget << " ms " << names[g] << ": "
+                    << sim.getScore() << endl;
+            }
+        }
+        cout << budget << " " << total/(corpus.size()*repeats) << " "
+            << double(rollouts)/max(turns, 1L) << endl;
+    }
+    return 0;
+}
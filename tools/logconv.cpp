@@ -0,0 +1,71 @@
+#include "DebugLog.hpp"
+#include "Replay.hpp"
+
+using namespace std;
+
+// The referee output is not part of the stderr dump, so the solution of a
+// turn is taken from the Ash position of the next one: targeting the point
+// Ash actually reached reproduces the same move. The last turn of a game
+// keeps Ash in place.
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        cerr << "usage: logconv <stderr.log|-> [out.cvzr]" << endl;
+        return 1;
+    }
+    ifstream ifs;
+    string inputPath = argv[1];
+    if (inputPath != "-")
+    {
+        ifs.open(inputPath.c_str(), std::ifstream::in);
+        if (!ifs)
+        {
+            cerr << "cannot read " << inputPath << endl;
+            return 1;
+        }
+    }
+    DebugLogParser parser(inputPath == "-" ? cin : ifs);
+    ReplayWriter writer;
+    bool writing = argc == 3;
+    if (writing && !writer.open(argv[2]))
+    {
+        cerr << "cannot open " << argv[2] << endl;
+        return 1;
+    }
+
+    GameData prev, curr;
+    bool hasPrev = false;
+    long games = 0;
+    long turns = 0;
+    while (parser.next(curr))
+    {
+        bool newGame = !hasPrev || DebugLogParser::isNewGame(prev, curr);
+        if (hasPrev && writing)
+        {
+            writer.writeTurn(prev, newGame ? prev.ashPos_ : curr.ashPos_);
+        }
+        if (newGame)
+        {
+            games++;
+            if (writing)
+                writer.beginGame();
+        }
+        swap(prev, curr);
+        hasPrev = true;
+        turns++;
+    }
+    if (hasPrev && writing)
+    {
+        writer.writeTurn(prev, prev.ashPos_);
+    }
+    cout << parser.getLineCount() << " lines, " << games << " games, "
+        << turns << " turns, " << parser.getSkippedLines()
+        << " lines skipped, " << parser.getDroppedTurns()
+        << " incomplete turns dropped" << endl;
+    if (writing)
+    {
+        cout << writer.getBytesWritten() << " bytes written" << endl;
+    }
+    return 0;
+}
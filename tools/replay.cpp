@@ -0,0 +1,151 @@
+#include <chrono>
+
+#include "AllocCounter.hpp"
+#include "Bounds.hpp"
+#include "Endgame.hpp"
+#include "Replay.hpp"
+#include "Simulator.hpp"
+
+using namespace std;
+
+void printUsage()
+{
+    cerr << "usage: replay record <log> scenario.dat..." << endl
+        << "       replay play <log>" << endl
+        << "       replay info <log>" << endl;
+}
+
+int record(string const &path, vector<string> const &scenarios)
+{
+    ReplayWriter writer;
+    if (!writer.open(path))
+    {
+        cerr << "cannot open " << path << endl;
+        return 1;
+    }
+    EndgameSolver endgame;
+    for (auto scenario: scenarios)
+    {
+        GameController game;
+        game.setVerbose(false);
+        game.setAdvisor(&endgame);
+        Simulator sim(Simulator::loadScenario(scenario));
+        int bound = Bounds::tight(sim);
+        writer.beginGame();
+        while (!sim.isOver())
+        {
+            GameData data = sim.getData();
+            game.loadGameData(data);
+            Position solution = game.playTurn();
+            writer.writeTurn(data, solution);
+            sim.step(solution);
+        }
+        cout << scenario << ": " << sim.getTurn() << " turns, score "
+            << sim.getScore() << ", bound " << bound << ", "
+            << 100.0*sim.getScore()/max(bound, 1) << "% of bound" << endl;
+    }
+    cout << writer.getBytesWritten() << " bytes written" << endl;
+    return 0;
+}
+
+int play(string const &path)
+{
+    ReplayReader reader;
+    if (!reader.open(path))
+    {
+        cerr << "cannot read " << path << endl;
+        return 1;
+    }
+    EndgameSolver endgame;
+    GameController game;
+    game.setVerbose(false);
+    game.setAdvisor(&endgame);
+    GameData data;
+    Position recorded;
+    long turns = 0;
+    long mismatches = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    uint64_t maxAllocations = 0;
+    Profiler::reset();
+    auto start = chrono::steady_clock::now();
+    while (reader.next(data, recorded))
+    {
+        if (reader.isNewGame())
+        {
+            game = GameController();
+            game.setVerbose(false);
+            game.setAdvisor(&endgame);
+        }
+        AllocCounter::reset();
+        game.loadGameData(data);
+        Position solution = game.playTurn();
+        allocations += AllocCounter::allocations();
+        bytes += AllocCounter::bytes();
+        maxAllocations = max(maxAllocations, AllocCounter::allocations());
+        if (solution.x_ != recorded.x_ || solution.y_ != recorded.y_)
+        {
+            mismatches++;
+        }
+        turns++;
+    }
+    double seconds = chrono::duration<double>(
+        chrono::steady_clock::now() - start).count();
+    cout << turns << " turns replayed, " << mismatches
+        << " solutions differ from the log, "
+        << turns/max(seconds, 1e-9) << " turns/s" << endl;
+    cout << double(allocations)/max(turns, 1L) << " allocations and "
+        << double(bytes)/max(turns, 1L) << " bytes per turn, at most "
+        << maxAllocations << " allocations in one turn" << endl;
+    Profiler::report(cout);
+    return 0;
+}
+
+int info(string const &path)
+{
+    ReplayReader reader;
+    if (!reader.open(path))
+    {
+        cerr << "cannot read " << path << endl;
+        return 1;
+    }
+    GameData data;
+    Position solution;
+    long games = 0;
+    long turns = 0;
+    long entities = 0;
+    auto start = chrono::steady_clock::now();
+    while (reader.next(data, solution))
+    {
+        games += reader.isNewGame();
+        turns++;
+        entities += data.humanCount_ + data.zombieCount_;
+    }
+    double seconds = chrono::duration<double>(
+        chrono::steady_clock::now() - start).count();
+    cout << games << " games, " << turns << " turns, "
+        << entities << " entities, " << reader.getSize() << " bytes ("
+        << double(reader.getSize())/max(turns, 1L) << " bytes/turn), "
+        << reader.getSize()/max(seconds, 1e-9)/1e6 << " MB/s decoded" << endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Trace::startFromEnv();
+    Trace::setThreadName("main");
+    if (argc < 3)
+    {
+        printUsage();
+        return 1;
+    }
+    string command = argv[1];
+    if (command == "record" && argc >= 4)
+        return record(argv[2], vector<string>(argv + 3, argv + argc));
+    if (command == "play")
+        return play(argv[2]);
+    if (command == "info")
+        return info(argv[2]);
+    printUsage();
+    return 1;
+}
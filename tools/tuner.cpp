@@ -0,0 +1,87 @@
+#include <thread>
+
+#include "Tuner.hpp"
+
+using namespace std;
+
+void printUsage()
+{
+    cerr << "usage: tuner [-g generations] [-j threads] [-l lambda]"
+        << " [-s seed] [-o header] scenario.dat..." << endl;
+}
+
+int main(int argc, char** argv)
+{
+    int generations = 30;
+    unsigned threads = max(thread::hardware_concurrency(), 1u);
+    int lambda = 0;
+    unsigned seed = 1;
+    string headerPath = "inc/TunedParams.hpp";
+    vector<GameData> corpus;
+    Trace::startFromEnv();
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg[0] == '-' && i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        if (arg == "-g")
+            generations = atoi(argv[++i]);
+        else if (arg == "-j")
+            threads = atoi(argv[++i]);
+        else if (arg == "-l")
+            lambda = atoi(argv[++i]);
+        else if (arg == "-s")
+            seed = atoi(argv[++i]);
+        else if (arg == "-o")
+            headerPath = argv[++i];
+        else
+            corpus.push_back(Simulator::loadScenario(arg));
+    }
+    if (corpus.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    StrategyParams bestParams;
+    vector<StrategyParams> defaults(1, bestParams);
+    double bestScore = Tuner::evaluate(defaults, corpus, threads)[0];
+    cerr << "default params: " << bestScore << endl;
+
+    CmaEs cma(Tuner::encode(bestParams), 0.5,
+        max(lambda, int(threads)), seed);
+    for (int gen = 0; gen < generations; gen++)
+    {
+        vector<vector<double> > xs = cma.ask();
+        vector<StrategyParams> candidates;
+        for (auto x: xs)
+        {
+            candidates.push_back(Tuner::decode(x));
+        }
+        vector<double> scores = Tuner::evaluate(candidates, corpus, threads);
+        vector<double> costs;
+        for (unsigned i = 0; i < scores.size(); i++)
+        {
+            costs.push_back(-scores[i]);
+            if (scores[i] > bestScore)
+            {
+                bestScore = scores[i];
+                bestParams = candidates[i];
+            }
+        }
+        cma.tell(xs, costs);
+        cerr << "generation " << gen
+            << " best: " << *max_element(scores.begin(), scores.end())
+            << " overall: " << bestScore
+            << " sigma: " << cma.getSigma() << endl;
+    }
+
+    ofstream ofs(headerPath.c_str(), std::ofstream::out);
+    Tuner::writeHeader(ofs, bestParams);
+    Tuner::writeHeader(cout, bestParams);
+    return 0;
+}